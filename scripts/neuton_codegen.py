@@ -0,0 +1,380 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 Nordic Semiconductor ASA
+# SPDX-License-Identifier: Apache-2.0
+#
+"""Generate application side C code of a Neuton q16 model.
+
+Reads the nRF Edge AI Lab solution nrf_edgeai_user_model.c and writes either:
+- the straight-line model inference, one C function: every neuron is a sum of its links
+  with the weights as immediates, the inputs and neurons are referenced directly, the bias
+  links are folded to constants and the activation of every neuron is known at generation,
+- or, with --packed, the model graph packed into one stream of neuron records with 8-bit
+  links interleaved with their weights, run by edgeai_neuton_run_packed_q16().
+Both are bit-exact with nrf_nn_neuton_run_inference_q16() of the library.
+
+The model inputs the outputs depend on are reported, the extracted features not consumed
+by the model are not computed by the application runtime.
+
+Usage:
+    scripts/neuton_codegen.py src/nrf_edgeai_lib/nrf_edgeai_generated/nrf_edgeai_user_model.c \\
+        -o src/edgeai_model_unrolled.c
+    scripts/neuton_codegen.py src/nrf_edgeai_lib/nrf_edgeai_generated/nrf_edgeai_user_model.c \\
+        --packed -o src/edgeai_model_packed.c
+
+Check the generated code with the host tests, test_edgeai_model_ref and test_edgeai_model_lut fail
+when the code is not generated from the committed model or its neuron values differ from the library
+interpreter:
+    cmake -S tests/host -B build_host && cmake --build build_host && ctest --test-dir build_host
+"""
+
+import argparse
+import re
+import sys
+
+# Bias input of the links beyond the model inputs
+BIAS_INPUT = 65535
+
+# Sigmoid of the zero argument, taken by the neurons with zero activation weight
+SIGMOID_HALF = 32768
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+
+
+def parse_defines(source):
+    defines = {}
+    for name, value in re.findall(r'^#define[ \t]+(\w+)[ \t]+(.+?)[ \t]*$', source, re.MULTILINE):
+        defines[name] = value
+    return defines
+
+
+def parse_arrays(source):
+    arrays = {}
+    for name, body in re.findall(r'static const \w+ (MODEL_\w+)\[\] = \{(.*?)\};', source, re.DOTALL):
+        arrays[name] = [int(value, 0) for value in re.findall(r'-?\w+', body)]
+    return arrays
+
+
+def define_int(defines, name):
+    return int(defines[name].strip('()'), 0)
+
+
+def fnv_hash(model):
+    """Same as edgeai_neuton_model_hash_q16(), 16-bit values low byte first."""
+    data = bytearray()
+    for name in ('weights', 'links', 'internal', 'external', 'act_weights'):
+        for value in model[name]:
+            data += (value & 0xFFFF).to_bytes(2, 'little')
+    data += bytes(model['act_mask'][:(model['neurons_num'] + 7) // 8])
+
+    hash_value = FNV_OFFSET
+    for byte in data:
+        hash_value = ((hash_value ^ byte) * FNV_PRIME) & 0xFFFFFFFF
+    return hash_value
+
+
+def load_model(path):
+    with open(path) as f:
+        source = f.read()
+
+    defines = parse_defines(source)
+    arrays = parse_arrays(source)
+
+    if defines.get('MODEL_PARAMS_TYPE') != 'q16':
+        sys.exit('only q16 models are supported')
+
+    model = {
+        'solution_id': defines['MODEL_SOLUTION_ID_STR'].strip('"'),
+        'neurons_num': define_int(defines, 'MODEL_NEURONS_NUM'),
+        'weights': arrays['MODEL_WEIGHTS'],
+        'links': arrays['MODEL_NEURONS_LINKS'],
+        'internal': arrays['MODEL_NEURON_INTERNAL_LINKS_NUM'],
+        'external': arrays['MODEL_NEURON_EXTERNAL_LINKS_NUM'],
+        'act_weights': arrays['MODEL_NEURON_ACTIVATION_WEIGHTS'],
+        'act_mask': arrays['MODEL_NEURON_ACTIVATION_TYPE_MASK'],
+        'outputs': arrays['MODEL_OUTPUT_NEURONS_INDICES'],
+    }
+
+    # Library takes the raw input window when the model uses it, the extracted features otherwise
+    model['uses_as_input'] = (define_int(defines, 'MODEL_USES_AS_INPUT_INPUT_FEATURES') |
+                              (define_int(defines, 'MODEL_USES_AS_INPUT_DSP_FEATURES') << 1))
+    model['is_raw_input'] = (model['uses_as_input'] & 1) != 0
+    if model['is_raw_input']:
+        model['inputs_num'] = (define_int(defines, 'INPUT_UNIQ_FEATURES_USED_NUM') *
+                               define_int(defines, 'INPUT_WINDOW_SIZE'))
+    else:
+        model['inputs_num'] = define_int(defines, 'EXTRACTED_FEATURES_NUM')
+
+    weights_num = define_int(defines, 'MODEL_WEIGHTS_NUM')
+    if (len(model['weights']) != weights_num or len(model['links']) != weights_num or
+            len(model['internal']) != model['neurons_num'] or len(model['external']) != model['neurons_num']):
+        sys.exit('model arrays do not match the model size')
+
+    return model
+
+
+def consumed_inputs(model):
+    """Model inputs the outputs depend on, as edgeai_neuton_consumed_inputs_q16().
+    Return the set of consumed input indices."""
+    def links_used(n):
+        is_relu = (model['act_mask'][n >> 3] >> (n & 7)) & 1
+        return is_relu or model['act_weights'][n] != 0
+
+    def links(n, end):
+        start = model['external'][n - 1] if n > 0 else 0
+        first = start if end == 'internal' else model['internal'][n]
+        return [(model['links'][w], model['weights'][w]) for w in range(first, model[end][n])]
+
+    live = set(model['outputs'])
+    is_changed = True
+    while is_changed:
+        is_changed = False
+        for n in sorted(live, reverse=True):
+            if not links_used(n):
+                continue
+            for link, weight in links(n, 'internal'):
+                if weight != 0 and link not in live:
+                    live.add(link)
+                    is_changed = True
+
+    consumed = set()
+    for n in live:
+        if links_used(n):
+            consumed |= {link for link, weight in links(n, 'external') if link < model['inputs_num'] and weight != 0}
+    return consumed
+
+
+def report_inputs(model):
+    consumed = consumed_inputs(model)
+    kind = 'raw inputs' if model['is_raw_input'] else 'extracted features'
+    print('model %s: %d of %d %s consumed' % (model['solution_id'], len(consumed), model['inputs_num'], kind))
+
+    unused = sorted(set(range(model['inputs_num'])) - consumed)
+    if unused and not model['is_raw_input']:
+        print('  not computed with CONFIG_EDGEAI_FEATURES_PRUNING: %s' % ', '.join(str(i) for i in unused))
+
+
+def emit_neuron(model, n, w):
+    """Emit neuron n, its links start at weight w.
+    Return the emitted lines, the next weight and whether the links sum is used."""
+    is_relu = (model['act_mask'][n >> 3] >> (n & 7)) & 1
+    act_weight = model['act_weights'][n]
+    lines = []
+    is_acc_used = False
+    bias = 0
+    terms = []
+
+    # Internal links are taken first, the neurons computed before in this inference are locals,
+    # the others keep their values of the previous inference
+    while w < model['internal'][n]:
+        link = model['links'][w]
+        weight = model['weights'][w]
+        source = 'n%d' % link if link < n else 'p_neurons[%d]' % link
+        if weight != 0:
+            terms.append('%d * %s' % (weight, source))
+        w += 1
+
+    while w < model['external'][n]:
+        link = model['links'][w]
+        weight = model['weights'][w]
+        if link >= model['inputs_num']:
+            bias += weight * BIAS_INPUT
+        elif weight != 0:
+            terms.append('%d * p_inputs[%d]' % (weight, link))
+        w += 1
+
+    lines.append('    /** Neuron %d, %s */' % (n, 'ReLU' if is_relu else 'sigmoid'))
+
+    if not is_relu and act_weight == 0:
+        lines.append('    const uint16_t n%d = %d;' % (n, SIGMOID_HALF))
+    else:
+        is_acc_used = True
+        if -2**31 <= bias < 2**31:
+            lines.append('    acc = %d;' % bias)
+        else:
+            lines.append('    acc = INT64_C(%d);' % bias)
+        for term in terms:
+            lines.append('    acc += %s;' % term)
+        if is_relu:
+            lines.append('    const uint16_t n%d = edgeai_neuton_relu_q16(acc);' % n)
+        else:
+            lines.append('    const uint16_t n%d = edgeai_neuton_sigmoid_q16(%d, acc);' % (n, act_weight))
+
+    lines.append('    p_neurons[%d] = n%d;' % (n, n))
+    lines.append('')
+
+    return lines, w, is_acc_used
+
+
+def model_inputs(model):
+    if model['is_raw_input']:
+        return '(const uint16_t*)p_edgeai->input.window_memory.p_void'
+    return '(const uint16_t*)p_edgeai->p_dsp->features.extracted_memory.p_void'
+
+
+def library_size(model):
+    """Graph size in the library encoding, as edgeai_neuton_graph_size_q16()."""
+    return len(model['weights']) * 4 + model['neurons_num'] * 6 + (model['neurons_num'] + 7) // 8
+
+
+def emit_preamble(model, source_name, header):
+    out = []
+    out.append('/*')
+    out.append('* Copyright (c) 2024 Nordic Semiconductor ASA')
+    out.append('* SPDX-License-Identifier: Apache-2.0')
+    out.append('*/')
+    out.append('/* Generated by scripts/neuton_codegen.py from %s, do not edit */' % source_name)
+    out.append('')
+    out.append('// ///////////////////////// Package Header Files ////////////////////////////')
+    out.append('#include "%s"' % header)
+    out.append('#include "edgeai_neuton.h"')
+    out.append('')
+    out.append('//////////////////////////////////////////////////////////////////////////////')
+    out.append('')
+    out.append('/** Model the code is generated from */')
+    out.append('static const edgeai_neuton_model_id_t model_id_ = {')
+    out.append('    .p_solution_id = "%s",' % model['solution_id'])
+    out.append('    .graph_hash    = 0x%08Xu,' % fnv_hash(model))
+    out.append('    .neurons_num   = %d,' % model['neurons_num'])
+    out.append('    .weights_num   = %d,' % len(model['weights']))
+    out.append('    .inputs_num    = %d,' % model['inputs_num'])
+    out.append('    .uses_as_input = 0x%02X,' % model['uses_as_input'])
+    out.append('};')
+    out.append('')
+    return out
+
+
+def emit_unrolled(model, source_name):
+    out = emit_preamble(model, source_name, 'edgeai_model_unrolled.h')
+    out.append('//////////////////////////////////////////////////////////////////////////////')
+    out.append('')
+    out.append('bool edgeai_model_unrolled_supported(const nrf_edgeai_t* p_edgeai)')
+    out.append('{')
+    out.append('    return edgeai_neuton_model_matches(p_edgeai, &model_id_);')
+    out.append('}')
+    out.append('')
+    out.append('//////////////////////////////////////////////////////////////////////////////')
+    out.append('')
+    out.append('void edgeai_model_unrolled_run_inference_q16(nrf_edgeai_t* p_edgeai)')
+    out.append('{')
+    out.append('    const uint16_t* p_inputs = %s;' % model_inputs(model))
+    out.append('    uint16_t* p_neurons = p_edgeai->model.params.q16.p_neurons;')
+
+    neurons = []
+    is_acc_used = False
+    w = 0
+    for n in range(model['neurons_num']):
+        lines, w, is_used = emit_neuron(model, n, w)
+        neurons += lines
+        is_acc_used = is_acc_used or is_used
+
+    if is_acc_used:
+        out.append('    int64_t acc;')
+    out.append('')
+    out += neurons[:-1]
+    out.append('}')
+    out.append('')
+
+    return '\n'.join(out)
+
+
+def pack(model):
+    """Neuron records of the packed graph, see edgeai_neuton_packed_q16_t. Return the records bytes."""
+    if model['neurons_num'] + model['inputs_num'] >= 256:
+        sys.exit('links do not fit 8 bits, the model keeps the library encoding')
+
+    def weight_bytes(weight):
+        return (weight & 0xFFFF).to_bytes(2, 'little')
+
+    records = []
+    w = 0
+    for n in range(model['neurons_num']):
+        internal = []
+        external = []
+        bias = []
+        while w < model['internal'][n]:
+            internal.append((model['links'][w], model['weights'][w]))
+            w += 1
+        while w < model['external'][n]:
+            if model['links'][w] >= model['inputs_num']:
+                bias.append(model['weights'][w])
+            else:
+                external.append((model['links'][w], model['weights'][w]))
+            w += 1
+
+        if max(len(internal), len(external), len(bias)) > 255:
+            sys.exit('neuron %d has too many links for the packed encoding' % n)
+
+        is_relu = (model['act_mask'][n >> 3] >> (n & 7)) & 1
+        record = bytearray([len(internal), len(external), len(bias), is_relu])
+        record += (model['act_weights'][n] & 0xFFFF).to_bytes(2, 'little')
+        for link, weight in internal + external:
+            record += bytes([link]) + weight_bytes(weight)
+        for weight in bias:
+            record += weight_bytes(weight)
+        records.append(record)
+
+    return records
+
+
+def emit_packed(model, source_name):
+    records = pack(model)
+    stream_size = sum(len(record) for record in records)
+
+    out = emit_preamble(model, source_name, 'edgeai_model_packed.h')
+    out.append('/** Neuron records, %d bytes, the library encoding takes %d bytes */' %
+               (stream_size, library_size(model)))
+    out.append('static const uint8_t model_stream_[] = {')
+    for n, record in enumerate(records):
+        out.append('    /* Neuron %d */' % n)
+        for i in range(0, len(record), 12):
+            out.append('    ' + ' '.join('0x%02X,' % byte for byte in record[i:i + 12]))
+    out.append('};')
+    out.append('')
+    out.append('const edgeai_neuton_packed_q16_t edgeai_model_packed = {')
+    out.append('    .p_stream    = model_stream_,')
+    out.append('    .stream_size = sizeof(model_stream_),')
+    out.append('    .neurons_num = %d,' % model['neurons_num'])
+    out.append('};')
+    out.append('')
+    out.append('//////////////////////////////////////////////////////////////////////////////')
+    out.append('')
+    out.append('bool edgeai_model_packed_supported(const nrf_edgeai_t* p_edgeai)')
+    out.append('{')
+    out.append('    return edgeai_neuton_model_matches(p_edgeai, &model_id_);')
+    out.append('}')
+    out.append('')
+    out.append('//////////////////////////////////////////////////////////////////////////////')
+    out.append('')
+    out.append('void edgeai_model_packed_run_inference_q16(nrf_edgeai_t* p_edgeai)')
+    out.append('{')
+    out.append('    edgeai_neuton_run_packed_q16(&edgeai_model_packed, p_edgeai->model.params.q16.p_neurons,')
+    out.append('                                 %s);' % model_inputs(model))
+    out.append('}')
+    out.append('')
+
+    print('model %s: library encoding %d bytes, packed %d bytes' %
+          (model['solution_id'], library_size(model), stream_size))
+
+    return '\n'.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate application side C code of a Neuton q16 model')
+    parser.add_argument('model', help='nrf_edgeai_user_model.c of the nRF Edge AI Lab solution')
+    parser.add_argument('-o', '--output', required=True, help='generated C file')
+    parser.add_argument('--packed', action='store_true',
+                        help='generate the packed graph with 8-bit links instead of the straight-line inference')
+    args = parser.parse_args()
+
+    model = load_model(args.model)
+    report_inputs(model)
+    source_name = re.sub(r'^.*?(src/)', r'\1', args.model.replace('\\', '/'))
+
+    with open(args.output, 'w') as f:
+        f.write(emit_packed(model, source_name) if args.packed else emit_unrolled(model, source_name))
+
+
+if __name__ == '__main__':
+    main()
@@ -1,39 +1,264 @@
 #include "bsp_imu.h"
+#include "bsp_imu_bmi270.h"
+
+#if !defined(CONFIG_BSP_IMU_REPLAY)
 
 #include <zephyr/types.h>
 #include <zephyr/device.h>
 #include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/drivers/sensor.h>
+#include <zephyr/sys/byteorder.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+
+/** Fixed-point format of the sensor LSB to model units scale */
+#define LSB_TO_RAW_SCALE_Q          (28)
+#define LSB_TO_RAW_FRAC_MASK        ((1ULL << LSB_TO_RAW_SCALE_Q) - 1)
+/** Fixed-point results with fraction closer than 1/50 to an integer are converted by exact emulation,
+ *  float rounding of the reference conversion is below 1/75 of model unit in the whole sensor range
+ */
+#define LSB_TO_RAW_FRAC_GUARD       ((1ULL << LSB_TO_RAW_SCALE_Q) / 50)
+
+#define MICRO_IN_UNIT               (1000000ULL)
+#define FLOAT_MANTISSA_BITS         (24)
+
+/** Accelerometer and gyroscope data registers are read by a single burst of one frame size */
+#define DATA_REGS_ACC_OFFSET        (0)
+#define DATA_REGS_GYR_OFFSET        (6)
+
+BUILD_ASSERT(BMI270_FIFO_FRAME_SIZE == BSP_IMU_FRAME_AXES_NUM * sizeof(int16_t),
+             "FIFO frame is decoded in place of the output frame");
+/** Watermark should leave room in the sensor FIFO for at least one more burst */
+BUILD_ASSERT(BSP_IMU_FIFO_WATERMARK_FRAMES_MAX <= BMI270_FIFO_SIZE / BMI270_FIFO_FRAME_SIZE / 2,
+             "FIFO watermark limit exceeds half of the sensor FIFO");
+/** FIFO watermark and data ready interrupts are routed to INT1, the sensor driver must not claim the pin */
+BUILD_ASSERT(!IS_ENABLED(CONFIG_BMI270_TRIGGER),
+             "BMI270 interrupt pin is owned by bsp_imu, set CONFIG_BMI270_TRIGGER_NONE");
 
 //////////////////////////////////////////////////////////////////////////////
 
-static struct 
+static struct
 {
     bool initialized;
+    bool fifo_enabled;
     bsp_generic_cb_t data_ready_cb;
     const struct device* dev;
+    int32_t accel_fs_g;
+    int32_t gyro_fs_dps;
+    /** Sensor LSB to model units scale in Q28 format */
+    uint32_t accel_scale;
+    uint32_t gyro_scale;
+    /** Timestamp and sequence number of the last data ready interrupt */
+    uint64_t timestamp_us;
+    uint32_t sequence;
+    struct k_spinlock lock;
+    /** Asynchronous read in flight */
+    atomic_t async_busy;
+    bsp_async_drdy_cb_t async_drdy_cb;
+    uint16_t async_frames_num;
 } imu_ctx_ = {0};
 
 //////////////////////////////////////////////////////////////////////////////
 
-static void data_read_timer_handler(struct k_timer *timer)
+static void data_ready_handler_(void)
 {
-    (void) timer;
+    /** Timestamp is taken in the interrupt context to keep it free of the thread scheduling jitter */
+    const uint64_t timestamp_us = k_ticks_to_us_floor64(k_uptime_ticks());
+
+    k_spinlock_key_t key = k_spin_lock(&imu_ctx_.lock);
+    imu_ctx_.timestamp_us = timestamp_us;
+    imu_ctx_.sequence++;
+    k_spin_unlock(&imu_ctx_.lock, key);
+
     if (imu_ctx_.data_ready_cb)
     {
         imu_ctx_.data_ready_cb();
     }
 }
 
-K_TIMER_DEFINE(data_ready_timer_, data_read_timer_handler, NULL);
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Accelerometer and gyroscope register counts are converted to micro units exactly like the Zephyr BMI270 driver does
+ */
+static int64_t accel_lsb_to_micro_(int16_t lsb)
+{
+    return ((int64_t)lsb * SENSOR_G * (int64_t)imu_ctx_.accel_fs_g) / INT16_MAX;
+}
+
+static int64_t gyro_lsb_to_micro_(int16_t lsb)
+{
+    return ((int64_t)lsb * (int64_t)imu_ctx_.gyro_fs_dps * SENSOR_PI) / (180LL * INT16_MAX);
+}
+
+static float micro_to_phys_(int64_t micro)
+{
+    struct sensor_value value =
+    {
+        .val1 = micro / (int64_t)MICRO_IN_UNIT,
+        .val2 = micro % (int64_t)MICRO_IN_UNIT,
+    };
+    return (float)sensor_value_to_double(&value);
+}
 
 //////////////////////////////////////////////////////////////////////////////
 
-bsp_status_t bsp_imu_init(const bsp_imu_config_t* p_config,
-                            bsp_generic_cb_t data_ready_cb)
+static uint64_t round_shift_even_(uint64_t value, uint8_t shift)
+{
+    const uint64_t half = 1ULL << (shift - 1);
+    const uint64_t rem = value & ((1ULL << shift) - 1);
+    uint64_t result = value >> shift;
+
+    if ((rem > half) || ((rem == half) && (result & 1)))
+        result++;
+
+    return result;
+}
+
+/**
+ * Model units are computed from micro units by the reference float conversion:
+ * raw = (int16_t)((float)sensor_value_to_double(value) * 1000)
+ * Function emulates it with integers only: micro / 10^6 is rounded to float mantissa,
+ * multiplied by 1000 and rounded to float mantissa again (ties to even), then truncated.
+ * Double precision intermediate result is exact enough to always round like micro / 10^6 does.
+ */
+static int16_t micro_to_raw_(int64_t micro)
+{
+    const uint64_t magnitude = (micro < 0) ? -micro : micro;
+
+    if (magnitude == 0)
+        return 0;
+
+    /** Normalize so that magnitude * 2^shift / 10^6 is in [2^23, 2^24) */
+    int8_t shift = __builtin_clzll(magnitude) - __builtin_clzll(MICRO_IN_UNIT << (FLOAT_MANTISSA_BITS - 1));
+    if ((magnitude << shift) < (MICRO_IN_UNIT << (FLOAT_MANTISSA_BITS - 1)))
+        shift++;
+
+    const uint64_t scaled = magnitude << shift;
+    uint64_t mantissa = scaled / MICRO_IN_UNIT;
+    const uint64_t rem = scaled % MICRO_IN_UNIT;
+    if ((rem > MICRO_IN_UNIT / 2) || ((rem == MICRO_IN_UNIT / 2) && (mantissa & 1)))
+        mantissa++;
+
+    /** Multiplication by 1000 with rounding back to float mantissa */
+    uint64_t product = mantissa * 1000;
+    int8_t product_shift = (64 - __builtin_clzll(product)) - FLOAT_MANTISSA_BITS;
+    if (product_shift > 0)
+        product = round_shift_even_(product, product_shift);
+    else
+        product_shift = 0;
+
+    /** Truncation of product * 2^(product_shift - shift) */
+    const int8_t exponent = product_shift - shift;
+    const int32_t raw = (exponent >= 0) ? (int32_t)(product << exponent) : (int32_t)(product >> -exponent);
+
+    return (int16_t)((micro < 0) ? -raw : raw);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t lsb_to_raw_scale_(uint64_t micro_per_full_scale, uint64_t full_scale_lsb)
+{
+    /** Model unit is 1/1000 of physical unit */
+    const uint64_t den = full_scale_lsb * (MICRO_IN_UNIT / 1000);
+    return (uint32_t)(((micro_per_full_scale << LSB_TO_RAW_SCALE_Q) + den / 2) / den);
+}
+
+/**
+ * Fixed-point conversion, returns false if the result is too close to an integer boundary
+ * and has to be computed by @ref micro_to_raw_
+ */
+static bool lsb_to_raw_fast_(int16_t lsb, uint32_t scale, int16_t* p_raw)
+{
+    const uint32_t magnitude = (lsb < 0) ? -(int32_t)lsb : lsb;
+    const uint64_t value = (uint64_t)magnitude * scale;
+    const uint32_t frac = (uint32_t)(value & LSB_TO_RAW_FRAC_MASK);
+
+    if ((frac < LSB_TO_RAW_FRAC_GUARD) || (frac > LSB_TO_RAW_FRAC_MASK - LSB_TO_RAW_FRAC_GUARD))
+        return false;
+
+    const int32_t raw = (int32_t)(value >> LSB_TO_RAW_SCALE_Q);
+    *p_raw = (int16_t)((lsb < 0) ? -raw : raw);
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Decode sensor frames in place to interleaved model frames,
+ * accel_offset and gyro_offset are byte offsets of the axes in the sensor frame
+ */
+static void frames_decode_(uint8_t* p_data, uint16_t frames_num, uint8_t accel_offset, uint8_t gyro_offset)
+{
+    for (uint16_t frame = 0; frame < frames_num; frame++)
+    {
+        uint8_t* p_sensor_frame = &p_data[frame * BMI270_FIFO_FRAME_SIZE];
+        int16_t lsb[BSP_IMU_FRAME_AXES_NUM];
+
+        /** Frame is decoded in place, so sensor counts are fetched before the output is written */
+        for (int i = 0; i < 3; i++)
+        {
+            lsb[i] = (int16_t)sys_get_le16(&p_sensor_frame[accel_offset + i * sizeof(int16_t)]);
+            lsb[3 + i] = (int16_t)sys_get_le16(&p_sensor_frame[gyro_offset + i * sizeof(int16_t)]);
+        }
+
+        int16_t* p_frame = (int16_t*)p_sensor_frame;
+        for (int i = 0; i < 3; i++)
+        {
+            p_frame[i] = bsp_imu_accel_lsb_to_raw(lsb[i]);
+            p_frame[3 + i] = bsp_imu_gyro_lsb_to_raw(lsb[3 + i]);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+#if defined(CONFIG_BSP_IMU_BUS_EMUL)
+
+static uint8_t odr_to_conf_(int32_t data_rate_hz)
+{
+    uint8_t odr = BMI270_CONF_ODR_100HZ;
+
+    for (int32_t rate = 100; (rate < data_rate_hz) && (odr < BMI270_CONF_ODR_MASK); rate *= 2)
+        odr++;
+    for (int32_t rate = 100; (rate > data_rate_hz) && (odr > 1); rate /= 2)
+        odr--;
+
+    return odr;
+}
+
+static bsp_status_t sensor_configure_(const bsp_imu_config_t* p_config)
+{
+    /** Emulated sensor has no Zephyr driver instance and is configured through registers */
+    const uint8_t config[][2] =
+    {
+        { BMI270_REG_ACC_RANGE, (uint8_t)(31 - __builtin_clz(p_config->accel_fs_g >> 1)) },
+        { BMI270_REG_GYR_RANGE, (uint8_t)(31 - __builtin_clz(BSP_IMU_ACCEL_SCALE_2000DPS / p_config->gyro_fs_dps)) },
+        { BMI270_REG_ACC_CONF, odr_to_conf_(p_config->data_rate_hz) },
+        { BMI270_REG_GYR_CONF, odr_to_conf_(p_config->data_rate_hz) },
+        { BMI270_REG_PWR_CTRL, BMI270_PWR_CTRL_ACC_EN | BMI270_PWR_CTRL_GYR_EN },
+    };
+
+    BSP_VERIFY_VALID_ARG(p_config->accel_fs_g >= BSP_IMU_ACCEL_SCALE_2G);
+    BSP_VERIFY_VALID_ARG(p_config->gyro_fs_dps >= BSP_IMU_ACCEL_SCALE_125DPS);
+
+    for (size_t i = 0; i < COUNT_OF(config); i++)
+    {
+        bsp_status_t status = bsp_imu_bmi270_write(config[i][0], config[i][1]);
+        BSP_VERIFY_SUCCESS(status);
+    }
+
+    return BSP_STATUS_SUCCESS;
+}
+
+#else
+
+static bsp_status_t sensor_configure_(const bsp_imu_config_t* p_config)
 {
-    BSP_NULL_CHECK(p_config);
- 
     if (imu_ctx_.dev == NULL)
         imu_ctx_.dev = DEVICE_DT_GET_ONE(bosch_bmi270);
 
@@ -77,10 +302,6 @@ bsp_status_t bsp_imu_init(const bsp_imu_config_t* p_config,
 	res = sensor_attr_set(imu_ctx_.dev, SENSOR_CHAN_GYRO_XYZ, SENSOR_ATTR_OVERSAMPLING, &oversampling);
     BSP_RETURN_IF(res != 0, BSP_STATUS_HARDWARE_ERROR);
 
-    imu_ctx_.data_ready_cb = data_ready_cb;
-    const uint32_t data_ready_timer_period = 1000 / p_config->data_rate_hz;
-    k_timer_start(&data_ready_timer_, K_MSEC(data_ready_timer_period), K_MSEC(data_ready_timer_period));    
-
 	/* Set sampling frequency last as this also sets the appropriate
 	 * power mode. If already sampling, change sampling frequency to
 	 * 0.0Hz before changing other attributes
@@ -90,33 +311,304 @@ bsp_status_t bsp_imu_init(const bsp_imu_config_t* p_config,
 
     return BSP_STATUS_SUCCESS;
 }
-    
+
+#endif /* CONFIG_BSP_IMU_BUS_EMUL */
+
 //////////////////////////////////////////////////////////////////////////////
 
-bsp_status_t bsp_imu_read(bsp_imu_data_t* const p_data)
+static bsp_status_t fifo_configure_(uint16_t watermark_frames)
+{
+    const uint16_t watermark_bytes = watermark_frames * BMI270_FIFO_FRAME_SIZE;
+
+    /** Headerless stream mode with filtered accel and gyro data, the same data as in data registers */
+    const uint8_t config[][2] =
+    {
+        { BMI270_REG_FIFO_CONFIG_0, 0 },
+        { BMI270_REG_FIFO_DOWNS, BMI270_FIFO_DOWNS_FILT_DATA },
+        { BMI270_REG_FIFO_WTM_0, (uint8_t)(watermark_bytes & 0xFF) },
+        { BMI270_REG_FIFO_WTM_1, (uint8_t)(watermark_bytes >> 8) },
+        { BMI270_REG_FIFO_CONFIG_1, BMI270_FIFO_CONFIG_1_ACC_EN | BMI270_FIFO_CONFIG_1_GYR_EN },
+        { BMI270_REG_CMD, BMI270_CMD_FIFO_FLUSH },
+    };
+
+    for (size_t i = 0; i < COUNT_OF(config); i++)
+    {
+        bsp_status_t status = bsp_imu_bmi270_write(config[i][0], config[i][1]);
+        BSP_VERIFY_SUCCESS(status);
+    }
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static bsp_status_t int1_configure_(uint8_t int_map_data)
+{
+    /** Data interrupt is routed to INT1 pin as non latched active high push-pull output */
+    const uint8_t config[][2] =
+    {
+        { BMI270_REG_INT1_IO_CTRL, BMI270_INT_IO_CTRL_OUTPUT_EN | BMI270_INT_IO_CTRL_LVL_HIGH },
+        { BMI270_REG_INT_LATCH, 0 },
+        { BMI270_REG_INT_MAP_DATA, int_map_data },
+    };
+
+    bsp_status_t status = bsp_imu_bmi270_int1_configure(data_ready_handler_);
+    BSP_VERIFY_SUCCESS(status);
+
+    for (size_t i = 0; i < COUNT_OF(config); i++)
+    {
+        status = bsp_imu_bmi270_write(config[i][0], config[i][1]);
+        BSP_VERIFY_SUCCESS(status);
+    }
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_init(const bsp_imu_config_t* p_config,
+                            bsp_generic_cb_t data_ready_cb)
+{
+    BSP_NULL_CHECK(p_config);
+    BSP_VERIFY_VALID_ARG(p_config->data_rate_hz > 0);
+    BSP_VERIFY_VALID_ARG(p_config->fifo_watermark_frames <= BSP_IMU_FIFO_WATERMARK_FRAMES_MAX);
+
+    bsp_status_t status = bsp_imu_bmi270_bus_init();
+    BSP_VERIFY_SUCCESS(status);
+
+    status = sensor_configure_(p_config);
+    BSP_VERIFY_SUCCESS(status);
+
+    imu_ctx_.accel_fs_g = p_config->accel_fs_g;
+    imu_ctx_.gyro_fs_dps = p_config->gyro_fs_dps;
+    imu_ctx_.accel_scale = lsb_to_raw_scale_((uint64_t)SENSOR_G * p_config->accel_fs_g, INT16_MAX);
+    imu_ctx_.gyro_scale = lsb_to_raw_scale_((uint64_t)SENSOR_PI * p_config->gyro_fs_dps, 180ULL * INT16_MAX);
+    imu_ctx_.data_ready_cb = data_ready_cb;
+    imu_ctx_.fifo_enabled = (p_config->fifo_watermark_frames > 0);
+
+    /** Sensor interrupt drives the acquisition: FIFO watermark in FIFO mode, data ready otherwise */
+    if (imu_ctx_.fifo_enabled)
+    {
+        status = fifo_configure_(p_config->fifo_watermark_frames);
+        BSP_VERIFY_SUCCESS(status);
+
+        status = int1_configure_(BMI270_INT_MAP_DATA_FWM_INT1);
+        BSP_VERIFY_SUCCESS(status);
+    }
+    else
+    {
+        status = int1_configure_(BMI270_INT_MAP_DATA_DRDY_INT1);
+        BSP_VERIFY_SUCCESS(status);
+    }
+
+    imu_ctx_.initialized = true;
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_read_lsb(bsp_imu_lsb_data_t* const p_data)
 {
     BSP_NULL_CHECK(p_data);
-    BSP_RETURN_IF(imu_ctx_.dev == NULL, BSP_STATUS_HARDWARE_ERROR);
+    BSP_RETURN_IF(!imu_ctx_.initialized, BSP_STATUS_UNAVAILABLE);
 
-    struct sensor_value acc[3], gyr[3];
+    /** Accelerometer and gyroscope data registers are read by a single burst */
+    uint8_t data[BSP_IMU_FRAME_AXES_NUM * sizeof(int16_t)];
+    bsp_status_t status = bsp_imu_bmi270_read(BMI270_REG_ACC_X_LSB, data, sizeof(data));
+    BSP_VERIFY_SUCCESS(status);
 
-    int res = sensor_sample_fetch(imu_ctx_.dev);
-    BSP_RETURN_IF(res != 0, BSP_STATUS_HARDWARE_ERROR);
+    for (int i = 0; i < 3; i++)
+    {
+        p_data->accel[i] = (int16_t)sys_get_le16(&data[i * sizeof(int16_t)]);
+        p_data->gyro[i] = (int16_t)sys_get_le16(&data[(3 + i) * sizeof(int16_t)]);
+    }
 
-    res = sensor_channel_get(imu_ctx_.dev, SENSOR_CHAN_ACCEL_XYZ, acc);
-    BSP_RETURN_IF(res != 0, BSP_STATUS_HARDWARE_ERROR);
+    k_spinlock_key_t key = k_spin_lock(&imu_ctx_.lock);
+    p_data->timestamp_us = imu_ctx_.timestamp_us;
+    p_data->sequence = imu_ctx_.sequence;
+    k_spin_unlock(&imu_ctx_.lock, key);
 
-    res = sensor_channel_get(imu_ctx_.dev, SENSOR_CHAN_GYRO_XYZ, gyr);
-    BSP_RETURN_IF(res != 0, BSP_STATUS_HARDWARE_ERROR);
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_read(bsp_imu_data_t* const p_data)
+{
+    BSP_NULL_CHECK(p_data);
+
+    bsp_imu_lsb_data_t lsb;
+    bsp_status_t status = bsp_imu_read_lsb(&lsb);
+    BSP_VERIFY_SUCCESS(status);
 
     for (int i = 0; i < 3; i++)
     {
-        p_data->accel[i].phys = (float)sensor_value_to_double(&acc[i]);
-        p_data->accel[i].raw = (p_data->accel[i].phys * 1000);
+        p_data->accel[i].raw = bsp_imu_accel_lsb_to_raw(lsb.accel[i]);
+        p_data->accel[i].phys = bsp_imu_accel_lsb_to_phys(lsb.accel[i]);
 
-        p_data->gyro[i].phys = (float)sensor_value_to_double(&gyr[i]);
-        p_data->gyro[i].raw = (p_data->gyro[i].phys * 1000);
+        p_data->gyro[i].raw = bsp_imu_gyro_lsb_to_raw(lsb.gyro[i]);
+        p_data->gyro[i].phys = bsp_imu_gyro_lsb_to_phys(lsb.gyro[i]);
     }
 
+    p_data->timestamp_us = lsb.timestamp_us;
+    p_data->sequence = lsb.sequence;
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_read_frame(int16_t* p_frame)
+{
+    BSP_NULL_CHECK(p_frame);
+    BSP_RETURN_IF(!imu_ctx_.initialized, BSP_STATUS_UNAVAILABLE);
+
+    /** Data registers are read by a single burst into the output frame and decoded in place */
+    uint8_t* p_data = (uint8_t*)p_frame;
+    bsp_status_t status = bsp_imu_bmi270_read(BMI270_REG_ACC_X_LSB, p_data, BMI270_FIFO_FRAME_SIZE);
+    BSP_VERIFY_SUCCESS(status);
+
+    frames_decode_(p_data, 1, DATA_REGS_ACC_OFFSET, DATA_REGS_GYR_OFFSET);
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int16_t bsp_imu_accel_lsb_to_raw(int16_t lsb)
+{
+    int16_t raw;
+
+    if (lsb_to_raw_fast_(lsb, imu_ctx_.accel_scale, &raw))
+        return raw;
+
+    return micro_to_raw_(accel_lsb_to_micro_(lsb));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int16_t bsp_imu_gyro_lsb_to_raw(int16_t lsb)
+{
+    int16_t raw;
+
+    if (lsb_to_raw_fast_(lsb, imu_ctx_.gyro_scale, &raw))
+        return raw;
+
+    return micro_to_raw_(gyro_lsb_to_micro_(lsb));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+float bsp_imu_accel_lsb_to_phys(int16_t lsb)
+{
+    return micro_to_phys_(accel_lsb_to_micro_(lsb));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+float bsp_imu_gyro_lsb_to_phys(int16_t lsb)
+{
+    return micro_to_phys_(gyro_lsb_to_micro_(lsb));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_fifo_read(int16_t* p_frames, uint16_t max_frames, uint16_t* p_frames_num)
+{
+    BSP_NULL_CHECK(p_frames);
+    BSP_NULL_CHECK(p_frames_num);
+    BSP_RETURN_IF(!imu_ctx_.fifo_enabled, BSP_STATUS_UNAVAILABLE);
+
+    *p_frames_num = 0;
+
+    uint8_t fifo_length[2];
+    bsp_status_t status = bsp_imu_bmi270_read(BMI270_REG_FIFO_LENGTH_0, fifo_length, sizeof(fifo_length));
+    BSP_VERIFY_SUCCESS(status);
+
+    uint16_t frames_num = (sys_get_le16(fifo_length) & BMI270_FIFO_LENGTH_MASK) / BMI270_FIFO_FRAME_SIZE;
+    frames_num = MIN(frames_num, max_frames);
+
+    if (frames_num == 0)
+        return BSP_STATUS_SUCCESS;
+
+    /** All available frames are drained by a single burst read straight into the output buffer */
+    uint8_t* p_fifo_data = (uint8_t*)p_frames;
+    status = bsp_imu_bmi270_read(BMI270_REG_FIFO_DATA, p_fifo_data, frames_num * BMI270_FIFO_FRAME_SIZE);
+    BSP_VERIFY_SUCCESS(status);
+
+    frames_decode_(p_fifo_data, frames_num, BMI270_FIFO_FRAME_ACC_OFFSET, BMI270_FIFO_FRAME_GYR_OFFSET);
+
+    *p_frames_num = frames_num;
+
     return BSP_STATUS_SUCCESS;
-}
\ No newline at end of file
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void async_read_done_(void* data, uint32_t data_size)
+{
+    const uint16_t frames_num = (data_size > 0) ? imu_ctx_.async_frames_num : 0;
+    const bsp_async_drdy_cb_t drdy_cb = imu_ctx_.async_drdy_cb;
+
+    if (imu_ctx_.fifo_enabled)
+        frames_decode_(data, frames_num, BMI270_FIFO_FRAME_ACC_OFFSET, BMI270_FIFO_FRAME_GYR_OFFSET);
+    else
+        frames_decode_(data, frames_num, DATA_REGS_ACC_OFFSET, DATA_REGS_GYR_OFFSET);
+
+    /** Next read can be started from the user callback */
+    atomic_clear(&imu_ctx_.async_busy);
+
+    drdy_cb(data, frames_num * BSP_IMU_FRAME_AXES_NUM * sizeof(int16_t));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_read_async(int16_t* p_frames, uint16_t max_frames, bsp_async_drdy_cb_t drdy_cb)
+{
+    BSP_NULL_CHECK(p_frames);
+    BSP_NULL_CHECK(drdy_cb);
+    BSP_VERIFY_VALID_ARG(max_frames > 0);
+    BSP_RETURN_IF(!imu_ctx_.initialized, BSP_STATUS_UNAVAILABLE);
+    BSP_RETURN_IF(!atomic_cas(&imu_ctx_.async_busy, 0, 1), BSP_STATUS_BUSY);
+
+    uint8_t reg = BMI270_REG_ACC_X_LSB;
+    uint16_t frames_num = 1;
+    bsp_status_t status;
+
+    if (imu_ctx_.fifo_enabled)
+    {
+        /** FIFO fill level is a short blocking read, only the frames burst goes asynchronously */
+        uint8_t fifo_length[2];
+        status = bsp_imu_bmi270_read(BMI270_REG_FIFO_LENGTH_0, fifo_length, sizeof(fifo_length));
+        if (status != BSP_STATUS_SUCCESS)
+        {
+            atomic_clear(&imu_ctx_.async_busy);
+            return status;
+        }
+
+        frames_num = (sys_get_le16(fifo_length) & BMI270_FIFO_LENGTH_MASK) / BMI270_FIFO_FRAME_SIZE;
+        frames_num = MIN(frames_num, max_frames);
+        reg = BMI270_REG_FIFO_DATA;
+
+        if (frames_num == 0)
+        {
+            atomic_clear(&imu_ctx_.async_busy);
+            drdy_cb(p_frames, 0);
+            return BSP_STATUS_SUCCESS;
+        }
+    }
+
+    imu_ctx_.async_drdy_cb = drdy_cb;
+    imu_ctx_.async_frames_num = frames_num;
+
+    status = bsp_imu_bmi270_read_async(reg, (uint8_t*)p_frames, frames_num * BMI270_FIFO_FRAME_SIZE, async_read_done_);
+    if (status != BSP_STATUS_SUCCESS)
+    {
+        atomic_clear(&imu_ctx_.async_busy);
+    }
+
+    return status;
+}
+
+#endif /* !CONFIG_BSP_IMU_REPLAY */
@@ -29,6 +29,12 @@ extern "C" {
 #define BSP_IMU_ACCEL_SCALE_1000DPS (1000)
 #define BSP_IMU_ACCEL_SCALE_2000DPS (2000)
 
+/** Number of int16 values in one interleaved IMU frame: accel XYZ followed by gyro XYZ */
+#define BSP_IMU_FRAME_AXES_NUM      (6)
+
+/** Maximum hardware FIFO watermark in frames */
+#define BSP_IMU_FIFO_WATERMARK_FRAMES_MAX   (256)
+
 /**
  * @brief IMU sensor configurations
  */
@@ -42,9 +48,17 @@ typedef struct bsp_imu_config_s
 
     /** IMU data rate in Hz */
     int32_t data_rate_hz;
+
+    /** Hardware FIFO watermark in frames, data ready callback is called once per watermark.
+     *  0 - FIFO is not used, data ready callback is called for every sample
+     */
+    uint16_t fifo_watermark_frames;
 } bsp_imu_config_t;
 
-/** Inertial sensor data */
+/** Inertial sensor data,
+ *  raw - model units: accelerometer in 1/1000 of m/s^2, gyroscope in 1/1000 of rad/s,
+ *  phys - physical units: accelerometer in m/s^2, gyroscope in rad/s
+ */
 typedef struct bsp_imu_data_s
 {
     /** Accelerometer data */
@@ -59,19 +73,84 @@ typedef struct bsp_imu_data_s
         int16_t raw;
         float phys;
     } gyro[3];
+    /** Monotonic timestamp of the sensor data ready interrupt in microseconds */
+    uint64_t timestamp_us;
+    /** Sequence number of the sensor data ready interrupt, a gap means missed samples */
+    uint32_t sequence;
 } bsp_imu_data_t;
 
+/** Inertial sensor data in sensor register counts (LSB) */
+typedef struct bsp_imu_lsb_data_s
+{
+    /** Accelerometer XYZ counts */
+    int16_t accel[3];
+    /** Gyroscope XYZ counts */
+    int16_t gyro[3];
+    /** Monotonic timestamp of the sensor data ready interrupt in microseconds */
+    uint64_t timestamp_us;
+    /** Sequence number of the sensor data ready interrupt, a gap means missed samples */
+    uint32_t sequence;
+} bsp_imu_lsb_data_t;
+
 /**
  * @brief Initialize and start generation of IMU sensor data
  * 
  * @param p_config          IMU configuration settings @ref bsp_imu_config_t
- * @param data_ready_cb     Data ready callback, provided callback will be called when new data sample is ready for reading
+ * @param data_ready_cb     Data ready callback, provided callback will be called from the sensor interrupt context
+ *                          when new data sample (or FIFO watermark in FIFO mode) is ready for reading
  * 
  * @return Operation status @ref bsp_status_t 
  */
 bsp_status_t bsp_imu_init(const bsp_imu_config_t* p_config,
                             bsp_generic_cb_t data_ready_cb);
 
+/**
+ * @brief Read IMU sensor data in sensor register counts, no unit conversion is done
+ *
+ * @param p_data        Pointer to data to be filled @ref bsp_imu_lsb_data_t
+ *
+ * @return Operation status @ref bsp_status_t
+ */
+bsp_status_t bsp_imu_read_lsb(bsp_imu_lsb_data_t* const p_data);
+
+/**
+ * @brief Convert accelerometer register counts to model units (1/1000 of m/s^2) with integer arithmetic only,
+ *        the result is bit exact with the raw field of @ref bsp_imu_read
+ *
+ * @param lsb   Accelerometer register counts
+ *
+ * @return Accelerometer value in model units
+ */
+int16_t bsp_imu_accel_lsb_to_raw(int16_t lsb);
+
+/**
+ * @brief Convert gyroscope register counts to model units (1/1000 of rad/s) with integer arithmetic only,
+ *        the result is bit exact with the raw field of @ref bsp_imu_read
+ *
+ * @param lsb   Gyroscope register counts
+ *
+ * @return Gyroscope value in model units
+ */
+int16_t bsp_imu_gyro_lsb_to_raw(int16_t lsb);
+
+/**
+ * @brief Convert accelerometer register counts to physical units
+ *
+ * @param lsb   Accelerometer register counts
+ *
+ * @return Accelerometer value in m/s^2
+ */
+float bsp_imu_accel_lsb_to_phys(int16_t lsb);
+
+/**
+ * @brief Convert gyroscope register counts to physical units
+ *
+ * @param lsb   Gyroscope register counts
+ *
+ * @return Gyroscope value in rad/s
+ */
+float bsp_imu_gyro_lsb_to_phys(int16_t lsb);
+
 /**
  * @brief Read IMU sensor data 
  * 
@@ -81,6 +160,47 @@ bsp_status_t bsp_imu_init(const bsp_imu_config_t* p_config,
  */
 bsp_status_t bsp_imu_read(bsp_imu_data_t* const p_data);
 
+/**
+ * @brief Read one IMU sensor data sample straight into the model input format,
+ *        integer arithmetic only and no intermediate copies
+ *
+ * @param p_frame       Pointer to the interleaved frame to be filled, @ref BSP_IMU_FRAME_AXES_NUM values:
+ *                      accel XYZ followed by gyro XYZ in the same units as @ref bsp_imu_data_t raw
+ *
+ * @return Operation status @ref bsp_status_t
+ */
+bsp_status_t bsp_imu_read_frame(int16_t* p_frame);
+
+/**
+ * @brief Drain IMU sensor hardware FIFO with a single burst read,
+ *        available only if IMU was initialized with non zero fifo_watermark_frames
+ *
+ * @param p_frames      Pointer to the buffer to be filled with interleaved frames,
+ *                      each frame is @ref BSP_IMU_FRAME_AXES_NUM values in the same units as @ref bsp_imu_data_t raw
+ * @param max_frames    Maximum number of frames that fits into the buffer
+ * @param p_frames_num  Pointer to the number of frames read
+ *
+ * @return Operation status @ref bsp_status_t
+ */
+bsp_status_t bsp_imu_fifo_read(int16_t* p_frames, uint16_t max_frames, uint16_t* p_frames_num);
+
+/**
+ * @brief Start asynchronous read of IMU sensor data, the bus transfer goes in background
+ *        and the CPU is free until the completion callback. Must be called from thread context,
+ *        only one read can be in flight.
+ *
+ *        In FIFO mode all available FIFO frames up to max_frames are read, otherwise one data sample is read.
+ *        Frames are delivered in the same format as @ref bsp_imu_fifo_read output.
+ *
+ * @param p_frames      Pointer to the buffer to be filled with interleaved frames, must stay valid until the callback
+ * @param max_frames    Maximum number of frames that fits into the buffer
+ * @param drdy_cb       Completion callback, called from interrupt context with p_frames and the size of read frames
+ *                      in bytes, the size is 0 if FIFO was empty or the transfer failed
+ *
+ * @return Operation status @ref bsp_status_t, BSP_STATUS_BUSY if previous read is still in flight
+ */
+bsp_status_t bsp_imu_read_async(int16_t* p_frames, uint16_t max_frames, bsp_async_drdy_cb_t drdy_cb);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,130 @@
+/**
+ *
+ * @defgroup bsp_imu_bmi270 BMI270 register access
+ * @{
+ * @ingroup bsp_imu
+ *
+ * @brief Low level BMI270 register map and bus access used by the IMU module
+ *        for the functionality that is not covered by the Zephyr sensor driver.
+ *
+ */
+#ifndef __BSP_SENSOR_IMU_BMI270_H__
+#define __BSP_SENSOR_IMU_BMI270_H__
+
+#include <bsp_common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** BMI270 registers */
+#define BMI270_REG_CHIP_ID          (0x00)
+#define BMI270_REG_ACC_X_LSB        (0x0C)
+#define BMI270_REG_INT_STATUS_1     (0x1D)
+#define BMI270_REG_FIFO_LENGTH_0    (0x24)
+#define BMI270_REG_FIFO_DATA        (0x26)
+#define BMI270_REG_ACC_CONF         (0x40)
+#define BMI270_REG_ACC_RANGE        (0x41)
+#define BMI270_REG_GYR_CONF         (0x42)
+#define BMI270_REG_GYR_RANGE        (0x43)
+#define BMI270_REG_FIFO_DOWNS       (0x45)
+#define BMI270_REG_FIFO_WTM_0       (0x46)
+#define BMI270_REG_FIFO_WTM_1       (0x47)
+#define BMI270_REG_FIFO_CONFIG_0    (0x48)
+#define BMI270_REG_FIFO_CONFIG_1    (0x49)
+#define BMI270_REG_INT1_IO_CTRL     (0x53)
+#define BMI270_REG_INT_LATCH        (0x55)
+#define BMI270_REG_INT_MAP_DATA     (0x58)
+#define BMI270_REG_PWR_CTRL         (0x7D)
+#define BMI270_REG_CMD              (0x7E)
+
+/** BMI270 register fields */
+#define BMI270_CHIP_ID                  (0x24)
+#define BMI270_FIFO_LENGTH_MASK         (0x3FFF)
+#define BMI270_FIFO_WTM_MASK            (0x1FFF)
+#define BMI270_FIFO_DOWNS_FILT_DATA     (0x88)
+#define BMI270_FIFO_CONFIG_1_GYR_EN     (1 << 7)
+#define BMI270_FIFO_CONFIG_1_ACC_EN     (1 << 6)
+#define BMI270_FIFO_CONFIG_1_HEADER_EN  (1 << 4)
+#define BMI270_INT_IO_CTRL_LVL_HIGH     (1 << 1)
+#define BMI270_INT_IO_CTRL_OUTPUT_EN    (1 << 3)
+#define BMI270_INT_MAP_DATA_FWM_INT1    (1 << 1)
+#define BMI270_INT_MAP_DATA_DRDY_INT1   (1 << 2)
+#define BMI270_INT_STATUS_1_FWM         (1 << 1)
+#define BMI270_PWR_CTRL_GYR_EN          (1 << 1)
+#define BMI270_PWR_CTRL_ACC_EN          (1 << 2)
+#define BMI270_CMD_FIFO_FLUSH           (0xB0)
+
+/** ODR field of ACC_CONF/GYR_CONF, code 0x08 is 100 Hz and every next code doubles the rate */
+#define BMI270_CONF_ODR_MASK            (0x0F)
+#define BMI270_CONF_ODR_100HZ           (0x08)
+
+/** Size of one headerless FIFO frame with accelerometer and gyroscope enabled,
+ *  frame layout is gyro XYZ followed by accel XYZ, each axis is int16 little endian
+ */
+#define BMI270_FIFO_FRAME_SIZE          (12)
+#define BMI270_FIFO_FRAME_GYR_OFFSET    (0)
+#define BMI270_FIFO_FRAME_ACC_OFFSET    (6)
+
+/** Size of the sensor FIFO in bytes */
+#define BMI270_FIFO_SIZE                (6144)
+
+/**
+ * @brief Initialize BMI270 register bus
+ *
+ * @return Operation status @ref bsp_status_t
+ */
+bsp_status_t bsp_imu_bmi270_bus_init(void);
+
+/**
+ * @brief Burst read of BMI270 registers, the address is not incremented for FIFO_DATA register
+ *
+ * @param reg       First register address
+ * @param p_data    Pointer to the buffer to be filled
+ * @param len       Number of bytes to read
+ *
+ * @return Operation status @ref bsp_status_t
+ */
+bsp_status_t bsp_imu_bmi270_read(uint8_t reg, uint8_t* p_data, uint16_t len);
+
+/**
+ * @brief Start asynchronous burst read of BMI270 registers, only one transfer can be in flight
+ *
+ * @param reg       First register address
+ * @param p_data    Pointer to the buffer to be filled, must stay valid until completion
+ * @param len       Number of bytes to read
+ * @param done_cb   Completion callback, called from interrupt context with p_data and len,
+ *                  or with 0 size if the transfer failed
+ *
+ * @return Operation status @ref bsp_status_t
+ */
+bsp_status_t bsp_imu_bmi270_read_async(uint8_t reg, uint8_t* p_data, uint16_t len, bsp_async_drdy_cb_t done_cb);
+
+/**
+ * @brief Write BMI270 register
+ *
+ * @param reg       Register address
+ * @param value     Value to be written
+ *
+ * @return Operation status @ref bsp_status_t
+ */
+bsp_status_t bsp_imu_bmi270_write(uint8_t reg, uint8_t value);
+
+/**
+ * @brief Register handler of BMI270 INT1 pin, handler is called from interrupt context
+ *
+ * @param handler   Interrupt handler
+ *
+ * @return Operation status @ref bsp_status_t
+ */
+bsp_status_t bsp_imu_bmi270_int1_configure(bsp_irq_handler_t handler);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __BSP_SENSOR_IMU_BMI270_H__ */
+
+/**
+ * @}
+ */
@@ -0,0 +1,315 @@
+#include "bsp_imu_bmi270.h"
+
+#if defined(CONFIG_BSP_IMU_BUS_EMUL)
+
+#include <zephyr/types.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/byteorder.h>
+
+/**
+ * Emulated BMI270 register bus, used on boards without the sensor (e.g. native_sim).
+ * The emulator generates deterministic accel and gyro samples at the configured ODR,
+ * keeps the latest sample in the data registers, and pushes headerless frames into
+ * the FIFO. Data ready and FIFO watermark interrupts are routed to INT1.
+ */
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define EMUL_REGS_NUM       (0x80)
+#define EMUL_AXES_NUM       (6)
+/** Emulated bus transfer time per byte, 8 MHz SPI clock */
+#define EMUL_BYTE_TIME_NS   (1000)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static struct
+{
+    uint8_t regs[EMUL_REGS_NUM];
+    uint8_t fifo[BMI270_FIFO_SIZE];
+    uint16_t fifo_head;
+    uint16_t fifo_count;
+    uint32_t sample_counter;
+    bsp_irq_handler_t int1_handler;
+    struct k_spinlock lock;
+    /** Asynchronous read in flight */
+    struct
+    {
+        uint8_t reg;
+        uint8_t* p_data;
+        uint16_t len;
+        bsp_async_drdy_cb_t done_cb;
+    } async;
+} emul_ = {0};
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void emul_sample_timer_handler_(struct k_timer* timer);
+static void emul_async_timer_handler_(struct k_timer* timer);
+
+K_TIMER_DEFINE(emul_sample_timer_, emul_sample_timer_handler_, NULL);
+K_TIMER_DEFINE(emul_async_timer_, emul_async_timer_handler_, NULL);
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int16_t emul_axis_value_(uint32_t sample, uint8_t axis)
+{
+    /** Triangle wave with axis dependent period, amplitude and offset */
+    const int32_t half_period = 25 + 7 * axis;
+    const int32_t amplitude = 1024 + 512 * axis;
+    const int32_t offset = (axis == 2) ? 8192 : 0;
+    int32_t phase = (int32_t)(sample % (2 * half_period));
+
+    if (phase > half_period)
+        phase = 2 * half_period - phase;
+
+    return (int16_t)(offset - amplitude + (2 * amplitude * phase) / half_period);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint16_t emul_fifo_watermark_(void)
+{
+    uint16_t wtm = sys_get_le16(&emul_.regs[BMI270_REG_FIFO_WTM_0]);
+    return wtm & BMI270_FIFO_WTM_MASK;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static bool emul_fifo_push_(const uint8_t* p_frame)
+{
+    const uint16_t wtm = emul_fifo_watermark_();
+    const uint16_t count_before = emul_.fifo_count;
+
+    /** Stream mode, the oldest frame is dropped when FIFO is full */
+    if (emul_.fifo_count + BMI270_FIFO_FRAME_SIZE > BMI270_FIFO_SIZE)
+    {
+        emul_.fifo_head = (emul_.fifo_head + BMI270_FIFO_FRAME_SIZE) % BMI270_FIFO_SIZE;
+        emul_.fifo_count -= BMI270_FIFO_FRAME_SIZE;
+    }
+
+    uint16_t tail = (emul_.fifo_head + emul_.fifo_count) % BMI270_FIFO_SIZE;
+    for (uint16_t i = 0; i < BMI270_FIFO_FRAME_SIZE; i++)
+    {
+        emul_.fifo[tail] = p_frame[i];
+        tail = (tail + 1) % BMI270_FIFO_SIZE;
+    }
+    emul_.fifo_count += BMI270_FIFO_FRAME_SIZE;
+
+    const bool fwm_reached = (wtm > 0) && (count_before < wtm) && (emul_.fifo_count >= wtm);
+    if (fwm_reached)
+    {
+        emul_.regs[BMI270_REG_INT_STATUS_1] |= BMI270_INT_STATUS_1_FWM;
+    }
+
+    return fwm_reached && (emul_.regs[BMI270_REG_INT_MAP_DATA] & BMI270_INT_MAP_DATA_FWM_INT1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void emul_fifo_pop_(uint8_t* p_data, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++)
+    {
+        if (emul_.fifo_count > 0)
+        {
+            p_data[i] = emul_.fifo[emul_.fifo_head];
+            emul_.fifo_head = (emul_.fifo_head + 1) % BMI270_FIFO_SIZE;
+            emul_.fifo_count--;
+        }
+        else
+        {
+            /** Reading an empty FIFO returns the 0x8000 pattern */
+            p_data[i] = (i & 1) ? 0x80 : 0x00;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void emul_sample_timer_handler_(struct k_timer* timer)
+{
+    (void)timer;
+
+    const uint8_t pwr_ctrl = emul_.regs[BMI270_REG_PWR_CTRL];
+    const uint8_t fifo_config = emul_.regs[BMI270_REG_FIFO_CONFIG_1];
+    uint8_t frame[BMI270_FIFO_FRAME_SIZE];
+    bool int1_irq = false;
+
+    if ((pwr_ctrl & (BMI270_PWR_CTRL_ACC_EN | BMI270_PWR_CTRL_GYR_EN)) == 0)
+        return;
+
+    k_spinlock_key_t key = k_spin_lock(&emul_.lock);
+
+    for (uint8_t axis = 0; axis < EMUL_AXES_NUM; axis++)
+    {
+        sys_put_le16((uint16_t)emul_axis_value_(emul_.sample_counter, axis),
+                     &emul_.regs[BMI270_REG_ACC_X_LSB + axis * sizeof(int16_t)]);
+    }
+    emul_.sample_counter++;
+
+    if ((fifo_config & (BMI270_FIFO_CONFIG_1_ACC_EN | BMI270_FIFO_CONFIG_1_GYR_EN)) ==
+        (BMI270_FIFO_CONFIG_1_ACC_EN | BMI270_FIFO_CONFIG_1_GYR_EN))
+    {
+        /** Data registers keep accel before gyro, headerless FIFO frame is gyro first */
+        memcpy(&frame[BMI270_FIFO_FRAME_ACC_OFFSET], &emul_.regs[BMI270_REG_ACC_X_LSB], 6);
+        memcpy(&frame[BMI270_FIFO_FRAME_GYR_OFFSET], &emul_.regs[BMI270_REG_ACC_X_LSB + 6], 6);
+        int1_irq = emul_fifo_push_(frame);
+    }
+
+    if (emul_.regs[BMI270_REG_INT_MAP_DATA] & BMI270_INT_MAP_DATA_DRDY_INT1)
+    {
+        int1_irq = true;
+    }
+
+    k_spin_unlock(&emul_.lock, key);
+
+    if (int1_irq && emul_.int1_handler)
+    {
+        emul_.int1_handler();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void emul_sample_timer_restart_(void)
+{
+    const uint8_t odr = emul_.regs[BMI270_REG_ACC_CONF] & BMI270_CONF_ODR_MASK;
+    uint32_t period_us;
+
+    if (odr >= BMI270_CONF_ODR_100HZ)
+        period_us = 10000U >> (odr - BMI270_CONF_ODR_100HZ);
+    else
+        period_us = 10000U << (BMI270_CONF_ODR_100HZ - odr);
+
+    k_timer_start(&emul_sample_timer_, K_USEC(period_us), K_USEC(period_us));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_bmi270_bus_init(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&emul_.lock);
+
+    memset(emul_.regs, 0, sizeof(emul_.regs));
+    emul_.regs[BMI270_REG_CHIP_ID] = BMI270_CHIP_ID;
+    emul_.regs[BMI270_REG_ACC_CONF] = BMI270_CONF_ODR_100HZ;
+    emul_.regs[BMI270_REG_GYR_CONF] = BMI270_CONF_ODR_100HZ;
+    emul_.regs[BMI270_REG_FIFO_DOWNS] = BMI270_FIFO_DOWNS_FILT_DATA;
+    emul_.fifo_head = 0;
+    emul_.fifo_count = 0;
+    emul_.sample_counter = 0;
+
+    k_spin_unlock(&emul_.lock, key);
+
+    emul_sample_timer_restart_();
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_bmi270_read(uint8_t reg, uint8_t* p_data, uint16_t len)
+{
+    BSP_NULL_CHECK(p_data);
+    BSP_RETURN_IF(reg >= EMUL_REGS_NUM, BSP_STATUS_INVALID_ARGUMENT);
+
+    k_spinlock_key_t key = k_spin_lock(&emul_.lock);
+
+    if (reg == BMI270_REG_FIFO_DATA)
+    {
+        emul_fifo_pop_(p_data, len);
+    }
+    else
+    {
+        sys_put_le16(emul_.fifo_count & BMI270_FIFO_LENGTH_MASK, &emul_.regs[BMI270_REG_FIFO_LENGTH_0]);
+
+        for (uint16_t i = 0; i < len; i++)
+        {
+            p_data[i] = emul_.regs[(reg + i) % EMUL_REGS_NUM];
+        }
+
+        /** Interrupt status is cleared on read */
+        if ((reg <= BMI270_REG_INT_STATUS_1) && (reg + len > BMI270_REG_INT_STATUS_1))
+        {
+            emul_.regs[BMI270_REG_INT_STATUS_1] = 0;
+        }
+    }
+
+    k_spin_unlock(&emul_.lock, key);
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void emul_async_timer_handler_(struct k_timer* timer)
+{
+    (void)timer;
+
+    /** Data is sampled at the end of the emulated transfer and reported from the timer interrupt,
+     *  like the DMA transfer completion
+     */
+    bsp_status_t status = bsp_imu_bmi270_read(emul_.async.reg, emul_.async.p_data, emul_.async.len);
+
+    emul_.async.done_cb(emul_.async.p_data, (status == BSP_STATUS_SUCCESS) ? emul_.async.len : 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_bmi270_read_async(uint8_t reg, uint8_t* p_data, uint16_t len, bsp_async_drdy_cb_t done_cb)
+{
+    BSP_NULL_CHECK(p_data);
+    BSP_NULL_CHECK(done_cb);
+    BSP_RETURN_IF(reg >= EMUL_REGS_NUM, BSP_STATUS_INVALID_ARGUMENT);
+
+    emul_.async.reg = reg;
+    emul_.async.p_data = p_data;
+    emul_.async.len = len;
+    emul_.async.done_cb = done_cb;
+
+    k_timer_start(&emul_async_timer_, K_NSEC((uint32_t)len * EMUL_BYTE_TIME_NS), K_NO_WAIT);
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_bmi270_write(uint8_t reg, uint8_t value)
+{
+    BSP_RETURN_IF(reg >= EMUL_REGS_NUM, BSP_STATUS_INVALID_ARGUMENT);
+
+    k_spinlock_key_t key = k_spin_lock(&emul_.lock);
+
+    if (reg == BMI270_REG_CMD)
+    {
+        if (value == BMI270_CMD_FIFO_FLUSH)
+        {
+            emul_.fifo_head = 0;
+            emul_.fifo_count = 0;
+        }
+    }
+    else
+    {
+        emul_.regs[reg] = value;
+    }
+
+    k_spin_unlock(&emul_.lock, key);
+
+    if (reg == BMI270_REG_ACC_CONF)
+    {
+        emul_sample_timer_restart_();
+    }
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_bmi270_int1_configure(bsp_irq_handler_t handler)
+{
+    emul_.int1_handler = handler;
+    return BSP_STATUS_SUCCESS;
+}
+
+#endif /* CONFIG_BSP_IMU_BUS_EMUL */
@@ -0,0 +1,182 @@
+#include "bsp_imu_bmi270.h"
+
+#if !defined(CONFIG_BSP_IMU_BUS_EMUL) && !defined(CONFIG_BSP_IMU_REPLAY)
+
+#include <zephyr/types.h>
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/spi.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define BMI270_NODE DT_NODELABEL(bmi270)
+
+/** Read access is marked by MSB of the register address */
+#define BMI270_SPI_READ_BIT     (0x80)
+/** SPI read returns a dummy byte after the register address */
+#define BMI270_SPI_DUMMY_BYTES  (2)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static const struct spi_dt_spec bmi270_spi_ = SPI_DT_SPEC_GET(BMI270_NODE, SPI_WORD_SET(8) | SPI_TRANSFER_MSB, 0);
+static const struct gpio_dt_spec bmi270_int1_ = GPIO_DT_SPEC_GET_OR(BMI270_NODE, irq_gpios, {0});
+static struct gpio_callback int1_cb_data_;
+static bool int1_cb_added_ = false;
+static bsp_irq_handler_t int1_handler_ = NULL;
+
+#if defined(CONFIG_SPI_ASYNC)
+/** Asynchronous transfer buffers must stay valid until the transfer completes */
+static struct
+{
+    uint8_t addr;
+    struct spi_buf tx_buf;
+    struct spi_buf rx_buf[2];
+    struct spi_buf_set tx;
+    struct spi_buf_set rx;
+    uint8_t* p_data;
+    uint16_t len;
+    bsp_async_drdy_cb_t done_cb;
+} async_;
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void int1_interrupt_(const struct device* dev, struct gpio_callback* cb, uint32_t pins)
+{
+    ARG_UNUSED(dev);
+    ARG_UNUSED(cb);
+    ARG_UNUSED(pins);
+
+    if (int1_handler_)
+    {
+        int1_handler_();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_bmi270_bus_init(void)
+{
+    BSP_RETURN_IF(!spi_is_ready_dt(&bmi270_spi_), BSP_STATUS_HARDWARE_ERROR);
+
+    uint8_t chip_id = 0;
+    bsp_status_t status = bsp_imu_bmi270_read(BMI270_REG_CHIP_ID, &chip_id, sizeof(chip_id));
+    BSP_VERIFY_SUCCESS(status);
+    BSP_RETURN_IF(chip_id != BMI270_CHIP_ID, BSP_STATUS_HARDWARE_ERROR);
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_bmi270_read(uint8_t reg, uint8_t* p_data, uint16_t len)
+{
+    BSP_NULL_CHECK(p_data);
+
+    uint8_t addr = reg | BMI270_SPI_READ_BIT;
+    const struct spi_buf tx_buf = { .buf = &addr, .len = sizeof(addr) };
+    const struct spi_buf_set tx = { .buffers = &tx_buf, .count = 1 };
+    const struct spi_buf rx_buf[] =
+    {
+        { .buf = NULL, .len = BMI270_SPI_DUMMY_BYTES },
+        { .buf = p_data, .len = len },
+    };
+    const struct spi_buf_set rx = { .buffers = rx_buf, .count = ARRAY_SIZE(rx_buf) };
+
+    int res = spi_transceive_dt(&bmi270_spi_, &tx, &rx);
+    BSP_RETURN_IF(res != 0, BSP_STATUS_HARDWARE_ERROR);
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+#if defined(CONFIG_SPI_ASYNC)
+
+static void spi_async_done_(const struct device* dev, int result, void* data)
+{
+    ARG_UNUSED(dev);
+    ARG_UNUSED(data);
+
+    async_.done_cb(async_.p_data, (result == 0) ? async_.len : 0);
+}
+
+bsp_status_t bsp_imu_bmi270_read_async(uint8_t reg, uint8_t* p_data, uint16_t len, bsp_async_drdy_cb_t done_cb)
+{
+    BSP_NULL_CHECK(p_data);
+    BSP_NULL_CHECK(done_cb);
+
+    async_.addr = reg | BMI270_SPI_READ_BIT;
+    async_.p_data = p_data;
+    async_.len = len;
+    async_.done_cb = done_cb;
+
+    async_.tx_buf = (struct spi_buf){ .buf = &async_.addr, .len = sizeof(async_.addr) };
+    async_.rx_buf[0] = (struct spi_buf){ .buf = NULL, .len = BMI270_SPI_DUMMY_BYTES };
+    async_.rx_buf[1] = (struct spi_buf){ .buf = p_data, .len = len };
+    async_.tx = (struct spi_buf_set){ .buffers = &async_.tx_buf, .count = 1 };
+    async_.rx = (struct spi_buf_set){ .buffers = async_.rx_buf, .count = ARRAY_SIZE(async_.rx_buf) };
+
+    /** Transfer is driven by SPIM EasyDMA, completion is reported from the SPI interrupt */
+    int res = spi_transceive_cb(bmi270_spi_.bus, &bmi270_spi_.config, &async_.tx, &async_.rx, spi_async_done_, NULL);
+    BSP_RETURN_IF(res != 0, BSP_STATUS_HARDWARE_ERROR);
+
+    return BSP_STATUS_SUCCESS;
+}
+
+#else
+
+bsp_status_t bsp_imu_bmi270_read_async(uint8_t reg, uint8_t* p_data, uint16_t len, bsp_async_drdy_cb_t done_cb)
+{
+    ARG_UNUSED(reg);
+    ARG_UNUSED(p_data);
+    ARG_UNUSED(len);
+    ARG_UNUSED(done_cb);
+
+    return BSP_STATUS_NOT_SUPPORTED;
+}
+
+#endif /* CONFIG_SPI_ASYNC */
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_bmi270_write(uint8_t reg, uint8_t value)
+{
+    uint8_t data[] = { reg, value };
+    const struct spi_buf tx_buf = { .buf = data, .len = sizeof(data) };
+    const struct spi_buf_set tx = { .buffers = &tx_buf, .count = 1 };
+
+    int res = spi_write_dt(&bmi270_spi_, &tx);
+    BSP_RETURN_IF(res != 0, BSP_STATUS_HARDWARE_ERROR);
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_bmi270_int1_configure(bsp_irq_handler_t handler)
+{
+    BSP_RETURN_IF(bmi270_int1_.port == NULL, BSP_STATUS_NOT_SUPPORTED);
+    BSP_RETURN_IF(!gpio_is_ready_dt(&bmi270_int1_), BSP_STATUS_HARDWARE_ERROR);
+
+    int res = gpio_pin_configure_dt(&bmi270_int1_, GPIO_INPUT);
+    BSP_RETURN_IF(res != 0, BSP_STATUS_HARDWARE_ERROR);
+
+    res = gpio_pin_interrupt_configure_dt(&bmi270_int1_, GPIO_INT_EDGE_TO_ACTIVE);
+    BSP_RETURN_IF(res != 0, BSP_STATUS_HARDWARE_ERROR);
+
+    /** Callback is registered only once, repeated calls just replace the handler */
+    if (!int1_cb_added_)
+    {
+        gpio_init_callback(&int1_cb_data_, int1_interrupt_, BIT(bmi270_int1_.pin));
+        res = gpio_add_callback(bmi270_int1_.port, &int1_cb_data_);
+        BSP_RETURN_IF(res != 0, BSP_STATUS_HARDWARE_ERROR);
+        int1_cb_added_ = true;
+    }
+    int1_handler_ = handler;
+
+    return BSP_STATUS_SUCCESS;
+}
+
+#endif /* !CONFIG_BSP_IMU_BUS_EMUL && !CONFIG_BSP_IMU_REPLAY */
@@ -0,0 +1,306 @@
+#include "bsp_imu.h"
+
+#if defined(CONFIG_BSP_IMU_REPLAY)
+
+#include <stdlib.h>
+#include <zephyr/types.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/printk.h>
+
+#include <nsi_host_trampolines.h>
+#include "cmdline.h"
+#include "soc.h"
+
+/**
+ * IMU replay backend for native_sim, replaces the BMI270 backend of the IMU module.
+ * Frames are read from a host CSV file in the data collection mode format:
+ * acc_x,acc_y,acc_z,gyro_x,gyro_y,gyro_z in model units, one frame per line.
+ * Lines that are not six integers (e.g. boot log captured with the data) are skipped.
+ *
+ * Real-time mode releases frames at the configured data rate and emulates the FIFO watermark interrupt.
+ * Max-speed mode has no pacing, the next batch is signalled as soon as the previous one is read.
+ *
+ * Recorded data is already in model units, so sensor register counts API is not available.
+ */
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define REPLAY_READ_CHUNK_SIZE  (512)
+#define REPLAY_LINE_SIZE_MAX    (96)
+/** Host open() flag */
+#define REPLAY_HOST_O_RDONLY    (0)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static struct
+{
+    bool initialized;
+    bool eof;
+    int fd;
+    bsp_generic_cb_t data_ready_cb;
+    uint16_t watermark_frames;
+    /** Frames released by the replay timer and not read yet */
+    atomic_t released_frames;
+    uint32_t frames_read;
+    char chunk[REPLAY_READ_CHUNK_SIZE];
+    uint16_t chunk_len;
+    uint16_t chunk_pos;
+} replay_ = { .fd = -1 };
+
+static char* replay_file_ = CONFIG_BSP_IMU_REPLAY_FILE;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void replay_timer_handler_(struct k_timer* timer);
+
+K_TIMER_DEFINE(replay_timer_, replay_timer_handler_, NULL);
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void replay_options_(void)
+{
+    static struct args_struct_t replay_options[] =
+    {
+        {
+            .option = "imu-replay",
+            .name = "path",
+            .type = 's',
+            .dest = (void*)&replay_file_,
+            .descript = "CSV file with IMU frames to replay, default is " CONFIG_BSP_IMU_REPLAY_FILE,
+        },
+        ARG_TABLE_ENDMARKER
+    };
+
+    native_add_command_line_opts(replay_options);
+}
+
+NATIVE_TASK(replay_options_, PRE_BOOT_1, 1);
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void replay_timer_handler_(struct k_timer* timer)
+{
+    (void)timer;
+
+    const atomic_val_t released = atomic_inc(&replay_.released_frames) + 1;
+
+    /** Watermark interrupt is raised when the released frames cross the watermark */
+    if ((released == replay_.watermark_frames) && replay_.data_ready_cb)
+    {
+        replay_.data_ready_cb();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int replay_getc_(void)
+{
+    if (replay_.chunk_pos == replay_.chunk_len)
+    {
+        long len = nsi_host_read(replay_.fd, replay_.chunk, sizeof(replay_.chunk));
+        if (len <= 0)
+            return -1;
+
+        replay_.chunk_len = (uint16_t)len;
+        replay_.chunk_pos = 0;
+    }
+
+    return (unsigned char)replay_.chunk[replay_.chunk_pos++];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static bool replay_parse_line_(const char* p_line, int16_t* p_frame)
+{
+    for (int axis = 0; axis < BSP_IMU_FRAME_AXES_NUM; axis++)
+    {
+        char* p_end;
+        const long value = strtol(p_line, &p_end, 10);
+
+        if ((p_end == p_line) || (value < INT16_MIN) || (value > INT16_MAX))
+            return false;
+
+        /** Values are comma separated, the last one ends the line */
+        const char separator = (axis < BSP_IMU_FRAME_AXES_NUM - 1) ? ',' : '\0';
+        if (*p_end != separator)
+            return false;
+
+        p_frame[axis] = (int16_t)value;
+        p_line = p_end + 1;
+    }
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static bool replay_next_frame_(int16_t* p_frame)
+{
+    char line[REPLAY_LINE_SIZE_MAX];
+
+    while (!replay_.eof)
+    {
+        size_t len = 0;
+        int c;
+
+        while (((c = replay_getc_()) >= 0) && (c != '\n'))
+        {
+            if ((c != '\r') && (len < sizeof(line) - 1))
+                line[len++] = (char)c;
+        }
+        line[len] = '\0';
+
+        if (c < 0)
+            replay_.eof = true;
+
+        if (replay_parse_line_(line, p_frame))
+            return true;
+    }
+
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_init(const bsp_imu_config_t* p_config,
+                            bsp_generic_cb_t data_ready_cb)
+{
+    BSP_NULL_CHECK(p_config);
+    BSP_VERIFY_VALID_ARG(p_config->data_rate_hz > 0);
+    BSP_VERIFY_VALID_ARG(p_config->fifo_watermark_frames > 0);
+
+    replay_.fd = nsi_host_open(replay_file_, REPLAY_HOST_O_RDONLY);
+    if (replay_.fd < 0)
+    {
+        printk("Failed to open IMU replay file %s\n", replay_file_);
+        return BSP_STATUS_UNAVAILABLE;
+    }
+
+    replay_.data_ready_cb = data_ready_cb;
+    replay_.watermark_frames = p_config->fifo_watermark_frames;
+    atomic_set(&replay_.released_frames, 0);
+    replay_.initialized = true;
+
+    printk("IMU replay from %s\n", replay_file_);
+
+#if defined(CONFIG_BSP_IMU_REPLAY_MAX_SPEED)
+    if (data_ready_cb)
+    {
+        data_ready_cb();
+    }
+#else
+    const uint32_t period_us = 1000000U / (uint32_t)p_config->data_rate_hz;
+    k_timer_start(&replay_timer_, K_USEC(period_us), K_USEC(period_us));
+#endif
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_fifo_read(int16_t* p_frames, uint16_t max_frames, uint16_t* p_frames_num)
+{
+    BSP_NULL_CHECK(p_frames);
+    BSP_NULL_CHECK(p_frames_num);
+    BSP_RETURN_IF(!replay_.initialized, BSP_STATUS_UNAVAILABLE);
+
+    uint16_t frames_num = max_frames;
+#if !defined(CONFIG_BSP_IMU_REPLAY_MAX_SPEED)
+    frames_num = (uint16_t)MIN((atomic_val_t)frames_num, atomic_get(&replay_.released_frames));
+#endif
+
+    uint16_t frame = 0;
+    while ((frame < frames_num) && replay_next_frame_(&p_frames[frame * BSP_IMU_FRAME_AXES_NUM]))
+        frame++;
+
+#if !defined(CONFIG_BSP_IMU_REPLAY_MAX_SPEED)
+    atomic_sub(&replay_.released_frames, frame);
+#endif
+    replay_.frames_read += frame;
+    *p_frames_num = frame;
+
+    if (replay_.eof && (replay_.fd >= 0))
+    {
+        k_timer_stop(&replay_timer_);
+        nsi_host_close(replay_.fd);
+        replay_.fd = -1;
+        printk("IMU replay finished, %u frames\n", replay_.frames_read);
+    }
+
+#if defined(CONFIG_BSP_IMU_REPLAY_MAX_SPEED)
+    /** No pacing, the next batch is signalled right away */
+    if (!replay_.eof && (frame > 0) && replay_.data_ready_cb)
+    {
+        replay_.data_ready_cb();
+    }
+#endif
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_read_async(int16_t* p_frames, uint16_t max_frames, bsp_async_drdy_cb_t drdy_cb)
+{
+    BSP_NULL_CHECK(drdy_cb);
+
+    uint16_t frames_num = 0;
+    bsp_status_t status = bsp_imu_fifo_read(p_frames, max_frames, &frames_num);
+    BSP_VERIFY_SUCCESS(status);
+
+    /** Host file read has no background transfer, completion is reported right away */
+    drdy_cb(p_frames, frames_num * BSP_IMU_FRAME_AXES_NUM * sizeof(int16_t));
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_read(bsp_imu_data_t* const p_data)
+{
+    BSP_NULL_CHECK(p_data);
+
+    int16_t frame[BSP_IMU_FRAME_AXES_NUM];
+    uint16_t frames_num = 0;
+    bsp_status_t status = bsp_imu_fifo_read(frame, 1, &frames_num);
+    BSP_VERIFY_SUCCESS(status);
+    BSP_RETURN_IF(frames_num == 0, BSP_STATUS_UNAVAILABLE);
+
+    for (int i = 0; i < 3; i++)
+    {
+        p_data->accel[i].raw = frame[i];
+        p_data->accel[i].phys = frame[i] / 1000.0f;
+
+        p_data->gyro[i].raw = frame[3 + i];
+        p_data->gyro[i].phys = frame[3 + i] / 1000.0f;
+    }
+
+    p_data->timestamp_us = k_ticks_to_us_floor64(k_uptime_ticks());
+    p_data->sequence = replay_.frames_read;
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_read_frame(int16_t* p_frame)
+{
+    uint16_t frames_num = 0;
+    bsp_status_t status = bsp_imu_fifo_read(p_frame, 1, &frames_num);
+    BSP_VERIFY_SUCCESS(status);
+    BSP_RETURN_IF(frames_num == 0, BSP_STATUS_UNAVAILABLE);
+
+    return BSP_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bsp_status_t bsp_imu_read_lsb(bsp_imu_lsb_data_t* const p_data)
+{
+    ARG_UNUSED(p_data);
+
+    return BSP_STATUS_NOT_SUPPORTED;
+}
+
+#endif /* CONFIG_BSP_IMU_REPLAY */
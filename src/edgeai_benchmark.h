@@ -0,0 +1,101 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+#ifndef EDGEAI_BENCHMARK_H__
+#define EDGEAI_BENCHMARK_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+
+/**
+ * Startup benchmarks of the features extraction and the model inference,
+ * each is compiled only when enabled by its Kconfig option.
+ */
+
+/**
+ * @brief Time-domain features extraction benchmark results, in CPU cycles per window
+ */
+typedef struct edgeai_features_benchmark_s
+{
+    /** Library extraction, calling every pipeline function for every axis */
+    uint32_t library_cycles;
+
+    /** Extraction by the per-axis plans compiled from the features masks, without the features
+     *  the model does not consume, and by the plans of every feature of the masks */
+    uint32_t plans_cycles;
+    uint32_t unpruned_cycles;
+
+    /** Number of extracted features, and of them not computed since the model does not consume them */
+    uint16_t features_num;
+    uint16_t pruned_num;
+
+    /** Features extracted by the plans are equal to the library features */
+    bool is_bit_exact;
+} edgeai_features_benchmark_t;
+
+/**
+ * @brief Model inference benchmark results
+ */
+typedef struct edgeai_inference_benchmark_s
+{
+    /** CPU cycles per inference of the library interpreter, the packed graph
+     *  and the straight-line inference */
+    uint32_t library_cycles;
+    uint32_t packed_cycles;
+    uint32_t unrolled_cycles;
+
+    /** Model graph size in bytes, library encoding and packed graph */
+    uint32_t library_size;
+    uint32_t packed_size;
+
+    /** CPU cycles per sigmoid activation, knots computed the library way and taken from the table */
+    uint32_t sigmoid_ref_cycles;
+    uint32_t sigmoid_lut_cycles;
+
+    /** Neurons computed by the packed graph and the straight-line inference are equal to the library neurons,
+     *  sigmoid values of the table are equal to the library way values */
+    bool is_bit_exact;
+} edgeai_inference_benchmark_t;
+
+#if CONFIG_EDGEAI_FEATURES_BENCHMARK
+/**
+ * @brief Measure the time-domain features extraction of a pseudo-random window
+ *        by the library and by the compiled per-axis plans.
+ *
+ * Window statistics cache and min/max trackers are not used, so both extract the features from the window samples.
+ * When features are pruned, the plans of every feature are measured too, to show the cycles saved.
+ * Call before the first feed, the benchmark window is dropped.
+ *
+ * @param[in]  p_edgeai  Pointer to the model context
+ * @param[in]  runs      Number of extractions to average
+ * @param[out] p_result  Benchmark results
+ *
+ * @return NRF_EDGEAI_ERR_SUCCESS, NRF_EDGEAI_ERR_NOT_SUPPORTED for the library window
+ */
+nrf_edgeai_err_t edgeai_benchmark_features(nrf_edgeai_t* p_edgeai,
+                                           uint16_t runs,
+                                           edgeai_features_benchmark_t* p_result);
+#endif
+
+#if CONFIG_EDGEAI_INFERENCE_BENCHMARK
+/**
+ * @brief Measure the model inference of pseudo-random inputs by the library interpreter,
+ *        the packed graph and the straight-line inference generated from the model,
+ *        and the sigmoid activation with and without the knots table.
+ *
+ * Call before the first feed, the model inputs and neurons are overwritten.
+ *
+ * @param[in]  p_edgeai  Pointer to the model context
+ * @param[in]  runs      Number of inferences to average
+ * @param[out] p_result  Benchmark results
+ *
+ * @return NRF_EDGEAI_ERR_SUCCESS, NRF_EDGEAI_ERR_NOT_SUPPORTED if the model code is not generated from the model
+ */
+nrf_edgeai_err_t edgeai_benchmark_inference(nrf_edgeai_t* p_edgeai,
+                                            uint16_t runs,
+                                            edgeai_inference_benchmark_t* p_result);
+#endif
+
+#endif /* EDGEAI_BENCHMARK_H__ */
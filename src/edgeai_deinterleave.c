@@ -0,0 +1,152 @@
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_deinterleave.h"
+
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include <cmsis_core.h>
+#endif
+
+///
+/** Channels of the vectorized frames, accelerometer and gyroscope axes */
+#define DEINTERLEAVE_VECTOR_CHANNELS    (6)
+///
+
+#if defined(__SSE2__)
+/** Frames deinterleaved per vector iteration, each column gets one 128-bit vector */
+#define DEINTERLEAVE_VECTOR_FRAMES      (8)
+#else
+/** Frames deinterleaved per vector iteration, each column gets one packed 32-bit word */
+#define DEINTERLEAVE_VECTOR_FRAMES      (2)
+#endif
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+/** Low halfwords of two words, lo in the bottom half, PKHBT */
+#define PACK_LOW_(lo, hi)   __PKHBT((lo), (hi), 16)
+/** High halfwords of two words, lo in the bottom half, PKHTB */
+#define PACK_HIGH_(lo, hi)  __PKHTB((hi), (lo), 16)
+#else
+#define PACK_LOW_(lo, hi)   (((lo) & 0x0000FFFFU) | ((hi) << 16))
+#define PACK_HIGH_(lo, hi)  (((lo) >> 16) | ((hi) & 0xFFFF0000U))
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+#if defined(__SSE2__)
+/** Low and high halfwords of eight 32-bit words, in the word order */
+static inline void split_halves_(__m128i words_0, __m128i words_1, __m128i* p_low, __m128i* p_high)
+{
+    /** Each vector becomes [lo0 lo1 lo2 lo3 hi0 hi1 hi2 hi3] */
+    words_0 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(words_0, _MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0));
+    words_0 = _mm_shuffle_epi32(words_0, _MM_SHUFFLE(3, 1, 2, 0));
+    words_1 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(words_1, _MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0));
+    words_1 = _mm_shuffle_epi32(words_1, _MM_SHUFFLE(3, 1, 2, 0));
+
+    *p_low = _mm_unpacklo_epi64(words_0, words_1);
+    *p_high = _mm_unpackhi_epi64(words_0, words_1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Words 0, 1 and 2 of four frames of three 32-bit words */
+static inline void split_words_(const int16_t* p_frames, __m128i* p_words)
+{
+    const __m128 a = _mm_loadu_ps((const float*)&p_frames[0]);
+    const __m128 b = _mm_loadu_ps((const float*)&p_frames[8]);
+    const __m128 c = _mm_loadu_ps((const float*)&p_frames[16]);
+
+    /** Integer data is only moved by the float shuffles, the values are not interpreted */
+    __m128 t0 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+    p_words[0] = _mm_castps_si128(_mm_shuffle_ps(a, t0, _MM_SHUFFLE(2, 0, 3, 0)));
+
+    t0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+    __m128 t1 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+    p_words[1] = _mm_castps_si128(_mm_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0)));
+
+    t0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+    t1 = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0));
+    p_words[2] = _mm_castps_si128(_mm_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint16_t deinterleave_vector_(int16_t* p_columns,
+                                     uint16_t column_stride,
+                                     const int16_t* p_frames,
+                                     uint16_t frames_num)
+{
+    uint16_t i = 0;
+
+    for (; (uint16_t)(frames_num - i) >= DEINTERLEAVE_VECTOR_FRAMES; i += DEINTERLEAVE_VECTOR_FRAMES)
+    {
+        const int16_t* p_in = &p_frames[i * DEINTERLEAVE_VECTOR_CHANNELS];
+        int16_t* p_out = &p_columns[i];
+
+#if defined(__SSE2__)
+        __m128i words_0[3];
+        __m128i words_1[3];
+        split_words_(&p_in[0], words_0);
+        split_words_(&p_in[4 * DEINTERLEAVE_VECTOR_CHANNELS], words_1);
+
+        /** Word k of the frame holds the channels 2k and 2k + 1 */
+        for (uint16_t k = 0; k < 3; k++)
+        {
+            __m128i low;
+            __m128i high;
+            split_halves_(words_0[k], words_1[k], &low, &high);
+
+            _mm_storeu_si128((__m128i*)&p_out[(2 * k) * column_stride], low);
+            _mm_storeu_si128((__m128i*)&p_out[(2 * k + 1) * column_stride], high);
+        }
+#else
+        /** Word k of the frame holds the channels 2k and 2k + 1, unaligned word accesses */
+        uint32_t words[2 * 3];
+        memcpy(words, p_in, sizeof(words));
+
+        for (uint16_t k = 0; k < 3; k++)
+        {
+            const uint32_t low = PACK_LOW_(words[k], words[3 + k]);
+            const uint32_t high = PACK_HIGH_(words[k], words[3 + k]);
+
+            memcpy(&p_out[(2 * k) * column_stride], &low, sizeof(low));
+            memcpy(&p_out[(2 * k + 1) * column_stride], &high, sizeof(high));
+        }
+#endif
+    }
+
+    return i;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_deinterleave_i16(int16_t* p_columns,
+                             uint16_t column_stride,
+                             const int16_t* p_frames,
+                             uint16_t frames_num,
+                             uint16_t channels)
+{
+    assert((p_columns != NULL) && (p_frames != NULL));
+
+    uint16_t done = 0;
+
+    if (channels == DEINTERLEAVE_VECTOR_CHANNELS)
+        done = deinterleave_vector_(p_columns, column_stride, p_frames, frames_num);
+
+    for (uint16_t ch = 0; ch < channels; ch++)
+    {
+        int16_t* p_column = &p_columns[ch * column_stride];
+        const int16_t* p_value = &p_frames[done * channels + ch];
+
+        for (uint16_t i = done; i < frames_num; i++)
+        {
+            p_column[i] = *p_value;
+            p_value += channels;
+        }
+    }
+}
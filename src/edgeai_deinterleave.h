@@ -0,0 +1,29 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+#ifndef EDGEAI_DEINTERLEAVE_H__
+#define EDGEAI_DEINTERLEAVE_H__
+
+#include <stdint.h>
+
+/**
+ * @brief Deinterleave input frames to columns.
+ *
+ * Six channel frames of the IMU are moved by whole vectors, Cortex-M33 DSP halfword
+ * packing on target and SSE2 shuffles on x86 host builds, packed 32-bit words in
+ * portable C otherwise. Other channel counts are copied value by value.
+ *
+ * @param[out] p_columns      First value of the first column, no alignment is required
+ * @param[in]  column_stride  Distance between the columns in values
+ * @param[in]  p_frames       Interleaved input frames, channels values each
+ * @param[in]  frames_num     Number of input frames
+ * @param[in]  channels       Number of values in one frame
+ */
+void edgeai_deinterleave_i16(int16_t* p_columns,
+                             uint16_t column_stride,
+                             const int16_t* p_frames,
+                             uint16_t frames_num,
+                             uint16_t channels);
+
+#endif /* EDGEAI_DEINTERLEAVE_H__ */
@@ -0,0 +1,827 @@
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_features.h"
+
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#if CONFIG_EDGEAI_FEATURES_BACKEND_DSP
+#include <cmsis_core.h>
+#endif
+
+#include <nrf_edgeai/rt/private/features/dsp/nrf_edgeai_features_timedomain.h>
+#include <zephyr/sys/util.h>
+
+/**
+ * Time-domain features of int16 windows computed from two-segment spans.
+ * Integer arithmetic, rounding and overflow behavior follow the library feature functions,
+ * so the extracted features are bit-exact with the library extraction of the linear window.
+ * Statistics of all features are accumulated by fused passes, per-axis plans compiled from the
+ * features mask only derive the features present in the mask.
+ * The passes take two samples per Cortex-M33 DSP instruction with the DSP backend,
+ * the portable C backend is the reference of the same results.
+ */
+
+///
+/** Crossing rates and percentages are in 1/1000 */
+#define FEATURE_RATE_SCALE  (1000)
+
+/** Max number of features computed by one library feature function */
+#define FEATURE_OUTPUTS_MAX (3)
+
+/** Both halfword lanes of the packed sample pair set to one */
+#define PAIR_LANES_ONE      (0x00010001U)
+///
+
+/** Running statistics of the accumulating pass */
+typedef struct
+{
+    uint32_t sum;
+    uint64_t tss;
+    uint32_t abssum;
+    uint32_t positive_num;
+    int16_t min;
+    int16_t max;
+
+    /** Previous sample, neighbor of the next one */
+    int16_t prev;
+    uint32_t zero_crossings;
+    uint32_t diff_abssum;
+    uint32_t diff_square_sum;
+} accumulator_t;
+
+/** Running statistics of the mean dependent pass */
+typedef struct
+{
+    uint32_t deviation;
+    uint32_t mean_crossings;
+
+    /** Side of the mean of the previous sample */
+    uint32_t prev_side;
+} centered_accumulator_t;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int32_t feature_min_(const edgeai_span_stats_t* p_stats);
+static int32_t feature_max_(const edgeai_span_stats_t* p_stats);
+static int32_t feature_range_(const edgeai_span_stats_t* p_stats);
+static int32_t feature_mean_(const edgeai_span_stats_t* p_stats);
+static int32_t feature_mad_(const edgeai_span_stats_t* p_stats);
+static int32_t feature_std_(const edgeai_span_stats_t* p_stats);
+static int32_t feature_rms_(const edgeai_span_stats_t* p_stats);
+static int32_t feature_mcr_(const edgeai_span_stats_t* p_stats);
+static int32_t feature_zcr_(const edgeai_span_stats_t* p_stats);
+static int32_t feature_absmean_(const edgeai_span_stats_t* p_stats);
+static int32_t feature_amdf_(const edgeai_span_stats_t* p_stats);
+static int32_t feature_psoz_(const edgeai_span_stats_t* p_stats);
+static int32_t feature_rmds_(const edgeai_span_stats_t* p_stats);
+
+//////////////////////////////////////////////////////////////////////////////
+
+static const struct
+{
+    nrf_edgeai_features_pipeline_func_i16_t library_func;
+
+    /** Features in the library output order, each computed when its mask bit is set */
+    struct
+    {
+        uint32_t mask_bit;
+        edgeai_feature_emit_t emit;
+    } outputs[FEATURE_OUTPUTS_MAX];
+} SPAN_FEATURES_[] =
+{
+    /** Sum and tss are accumulated with the other moments */
+    { nrf_edgeai_feature_utility_tss_sum_i16, { { 0, NULL } } },
+    { nrf_edgeai_feature_min_max_range_i16, { { NRF_EDGEAI_FEATURE_BIT_MIN, feature_min_ }, { NRF_EDGEAI_FEATURE_BIT_MAX, feature_max_ }, { NRF_EDGEAI_FEATURE_BIT_RANGE, feature_range_ } } },
+    { nrf_edgeai_feature_min_i16, { { NRF_EDGEAI_FEATURE_BIT_MIN, feature_min_ } } },
+    { nrf_edgeai_feature_max_i16, { { NRF_EDGEAI_FEATURE_BIT_MAX, feature_max_ } } },
+    { nrf_edgeai_feature_mean_i16, { { NRF_EDGEAI_FEATURE_BIT_MEAN, feature_mean_ } } },
+    { nrf_edgeai_feature_mad_i16, { { NRF_EDGEAI_FEATURE_BIT_MAD, feature_mad_ } } },
+    { nrf_edgeai_feature_std_i16, { { NRF_EDGEAI_FEATURE_BIT_STD, feature_std_ } } },
+    { nrf_edgeai_feature_rms_i16, { { NRF_EDGEAI_FEATURE_BIT_RMS, feature_rms_ } } },
+    { nrf_edgeai_feature_mcr_i16, { { NRF_EDGEAI_FEATURE_BIT_MCR, feature_mcr_ } } },
+    { nrf_edgeai_feature_zcr_i16, { { NRF_EDGEAI_FEATURE_BIT_ZCR, feature_zcr_ } } },
+    { nrf_edgeai_feature_absmean_i16, { { NRF_EDGEAI_FEATURE_BIT_ABSMEAN, feature_absmean_ } } },
+    { nrf_edgeai_feature_amdf_i16, { { NRF_EDGEAI_FEATURE_BIT_AMDF, feature_amdf_ } } },
+    { nrf_edgeai_feature_psoz_i16, { { NRF_EDGEAI_FEATURE_BIT_PSOZ, feature_psoz_ } } },
+    { nrf_edgeai_feature_rmds_i16, { { NRF_EDGEAI_FEATURE_BIT_RMDS, feature_rmds_ } } },
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint16_t span_num_(const edgeai_span_t* p_span)
+{
+    return p_span->num[0] + p_span->num[1];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t sqrt_u32_(uint32_t x)
+{
+    if (x == 0)
+        return 0;
+
+    /** Initial guess and Newton iterations with rounded halving, as in the library */
+    uint32_t guess;
+    if (x & 0xFFFF0000U)
+        guess = (x & 0xFF000000U) ? 16383 : 1023;
+    else if (x & 0xFF00U)
+        guess = 63;
+    else
+        guess = (x < 5) ? x : 7;
+
+    uint32_t root = x;
+    for (;;)
+    {
+        guess += x / guess;
+        guess = (guess >> 1) + (guess & 1);
+        if (root <= guess)
+            break;
+        root = guess;
+    }
+
+    return root;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int16_t crossing_rate_(int16_t crossings, uint16_t num)
+{
+    const uint32_t pairs = (uint32_t)num - 1;
+
+    if (pairs == 0)
+        return 0;
+
+    return (int16_t)((uint32_t)((int32_t)crossings * FEATURE_RATE_SCALE) / pairs);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline int16_t mean_(const edgeai_span_stats_t* p_stats)
+{
+    return (int16_t)(p_stats->moments.sum / (int32_t)p_stats->num);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline bool needs_sums_(nrf_edgeai_features_timedomain_mask_t mask)
+{
+    return mask.is.mean || mask.is.mad || mask.is.std || mask.is.rms || mask.is.mcr ||
+           mask.is.absmean || mask.is.psoz;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline bool needs_extrema_(nrf_edgeai_features_timedomain_mask_t mask)
+{
+    return mask.is.min || mask.is.max || mask.is.range;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline bool needs_pairwise_(nrf_edgeai_features_timedomain_mask_t mask)
+{
+    return mask.is.zcr || mask.is.amdf || mask.is.rmds;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline void accumulate_sums_(accumulator_t* p_acc, int16_t value)
+{
+    p_acc->sum += (uint32_t)value;
+    p_acc->tss += (uint64_t)((int32_t)value * value);
+    p_acc->abssum += (uint16_t)((value < 0) ? -value : value);
+    p_acc->positive_num += (value > 0) ? 1 : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline void accumulate_extrema_(accumulator_t* p_acc, int16_t value)
+{
+    p_acc->min = MIN(p_acc->min, value);
+    p_acc->max = MAX(p_acc->max, value);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline void accumulate_pairwise_(accumulator_t* p_acc, int16_t value)
+{
+    /** Sign is bit 15, difference is squared after wrapping to int16, as in the library */
+    const int16_t prev = p_acc->prev;
+    const int32_t diff = prev - value;
+    const int16_t wrapped_diff = (int16_t)(uint16_t)((uint16_t)prev - (uint16_t)value);
+
+    if (((uint16_t)prev >> 15) != ((uint16_t)value >> 15))
+        p_acc->zero_crossings++;
+    p_acc->diff_abssum += (uint32_t)((diff < 0) ? -diff : diff);
+    p_acc->diff_square_sum += (uint32_t)((int32_t)wrapped_diff * wrapped_diff);
+    p_acc->prev = value;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline void accumulate_centered_sample_(centered_accumulator_t* p_acc, int16_t value, int16_t mean)
+{
+    /** Side of the mean is bit 15 of the difference, as in the library */
+    const int32_t diff = value - mean;
+    const uint32_t side = ((uint32_t)diff >> 15) & 1;
+
+    p_acc->deviation += (uint32_t)((diff < 0) ? -diff : diff);
+    if (side != p_acc->prev_side)
+        p_acc->mean_crossings++;
+    p_acc->prev_side = side;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+#if CONFIG_EDGEAI_FEATURES_BACKEND_DSP
+static inline uint32_t load_pair_(const int16_t* p_data)
+{
+    /** Unaligned word access, segments start at any sample */
+    uint32_t pair;
+    memcpy(&pair, p_data, sizeof(pair));
+
+    return pair;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint32_t halves_sum_(uint32_t pair)
+{
+    return (pair & 0xFFFFU) + (pair >> 16);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint32_t sign_changes_(uint32_t prev_pair, uint32_t pair)
+{
+    /** Neighbor of each lane is the previous sample: [prev.hi, pair.lo] */
+    const uint32_t signs = ((prev_pair >> 16) | (pair << 16)) ^ pair;
+
+    return ((signs >> 15) & 1U) + (signs >> 31);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+/**
+ * SEL picks the halfword lanes by the APSR.GE flags set by the preceding SSUB16.
+ * The compiler does not track GE between intrinsics and may place another GE setting
+ * instruction in between, so each subtraction and its selections are one asm block.
+ */
+static inline uint32_t pair_abs_(uint32_t pair, uint32_t* p_positive)
+{
+    /** Negated lanes wrap, so -32768 becomes 32768 as uint16, GE lanes are not positive */
+    uint32_t negated;
+    uint32_t abs_pair;
+    uint32_t positive;
+
+    __asm__("ssub16 %[negated], %[zero], %[pair]\n\t"
+            "sel    %[abs_pair], %[negated], %[pair]\n\t"
+            "sel    %[positive], %[zero], %[one]"
+            : [negated] "=&r" (negated), [abs_pair] "=&r" (abs_pair), [positive] "=&r" (positive)
+            : [pair] "r" (pair), [zero] "r" (0U), [one] "r" (PAIR_LANES_ONE)
+            : "cc");
+
+    *p_positive = positive;
+    return abs_pair;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint32_t pair_min_(uint32_t a, uint32_t b)
+{
+    uint32_t diff;
+    uint32_t min_pair;
+
+    __asm__("ssub16 %[diff], %[a], %[b]\n\t"
+            "sel    %[min_pair], %[b], %[a]"
+            : [diff] "=&r" (diff), [min_pair] "=r" (min_pair)
+            : [a] "r" (a), [b] "r" (b)
+            : "cc");
+
+    return min_pair;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint32_t pair_max_(uint32_t a, uint32_t b)
+{
+    uint32_t diff;
+    uint32_t max_pair;
+
+    __asm__("ssub16 %[diff], %[a], %[b]\n\t"
+            "sel    %[max_pair], %[a], %[b]"
+            : [diff] "=&r" (diff), [max_pair] "=r" (max_pair)
+            : [a] "r" (a), [b] "r" (b)
+            : "cc");
+
+    return max_pair;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint32_t pair_distance_(uint32_t a, uint32_t b, uint32_t* p_diff)
+{
+    /** Wrapped lanes of a - b, exact unsigned distance from the GE ordered lanes */
+    uint32_t diff;
+    uint32_t high;
+    uint32_t low;
+    uint32_t distance;
+
+    __asm__("ssub16 %[diff], %[a], %[b]\n\t"
+            "sel    %[high], %[a], %[b]\n\t"
+            "sel    %[low], %[b], %[a]\n\t"
+            "usub16 %[distance], %[high], %[low]"
+            : [diff] "=&r" (diff), [high] "=&r" (high), [low] "=&r" (low), [distance] "=r" (distance)
+            : [a] "r" (a), [b] "r" (b)
+            : "cc");
+
+    *p_diff = diff;
+    return distance;
+}
+#else
+/** Lane by lane equivalents of the GE helpers, for host builds of the DSP backend */
+static inline int32_t lane_(uint32_t pair, uint8_t lane)
+{
+    return (int16_t)(pair >> (16 * lane));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint32_t lanes_(uint32_t low, uint32_t high)
+{
+    return (low & 0xFFFFU) | (high << 16);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint32_t pair_abs_(uint32_t pair, uint32_t* p_positive)
+{
+    const int32_t low = lane_(pair, 0);
+    const int32_t high = lane_(pair, 1);
+
+    *p_positive = lanes_((low > 0) ? 1 : 0, (high > 0) ? 1 : 0);
+    return lanes_((uint32_t)((low < 0) ? -low : low), (uint32_t)((high < 0) ? -high : high));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint32_t pair_min_(uint32_t a, uint32_t b)
+{
+    return lanes_((uint32_t)MIN(lane_(a, 0), lane_(b, 0)), (uint32_t)MIN(lane_(a, 1), lane_(b, 1)));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint32_t pair_max_(uint32_t a, uint32_t b)
+{
+    return lanes_((uint32_t)MAX(lane_(a, 0), lane_(b, 0)), (uint32_t)MAX(lane_(a, 1), lane_(b, 1)));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint32_t pair_distance_(uint32_t a, uint32_t b, uint32_t* p_diff)
+{
+    const int32_t low = lane_(a, 0) - lane_(b, 0);
+    const int32_t high = lane_(a, 1) - lane_(b, 1);
+
+    *p_diff = lanes_((uint32_t)low, (uint32_t)high);
+    return lanes_((uint32_t)((low < 0) ? -low : low), (uint32_t)((high < 0) ? -high : high));
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint16_t accumulate_pairs_dsp_(accumulator_t* p_acc,
+                                      const int16_t* p_data,
+                                      uint16_t num,
+                                      bool sums,
+                                      bool extrema,
+                                      bool pairwise)
+{
+    uint32_t sum = p_acc->sum;
+    uint64_t tss = p_acc->tss;
+    uint32_t abssum = p_acc->abssum;
+    uint32_t positive_pair = 0;
+    uint32_t min_pair = (uint16_t)p_acc->min * PAIR_LANES_ONE;
+    uint32_t max_pair = (uint16_t)p_acc->max * PAIR_LANES_ONE;
+    uint32_t prev_pair = (uint32_t)(uint16_t)p_acc->prev << 16;
+    uint32_t zero_crossings = p_acc->zero_crossings;
+    uint32_t diff_abssum = p_acc->diff_abssum;
+    uint32_t diff_square_sum = p_acc->diff_square_sum;
+    uint16_t i = 0;
+
+    for (; (uint16_t)(num - i) >= 2; i += 2)
+    {
+        const uint32_t pair = load_pair_(&p_data[i]);
+
+        if (sums)
+        {
+            sum = __SMLAD(pair, PAIR_LANES_ONE, sum);
+            tss = __SMLALD(pair, pair, tss);
+
+            uint32_t positive;
+            abssum += halves_sum_(pair_abs_(pair, &positive));
+            positive_pair = __UADD16(positive_pair, positive);
+        }
+
+        if (extrema)
+        {
+            min_pair = pair_min_(pair, min_pair);
+            max_pair = pair_max_(pair, max_pair);
+        }
+
+        if (pairwise)
+        {
+            const uint32_t prev = (prev_pair >> 16) | (pair << 16);
+
+            /** Wrapped lanes for the squares, exact distance for the sum */
+            uint32_t wrapped_diff;
+            const uint32_t abs_diff = pair_distance_(prev, pair, &wrapped_diff);
+
+            zero_crossings += sign_changes_(prev_pair, pair);
+            diff_abssum += halves_sum_(abs_diff);
+            diff_square_sum = __SMLAD(wrapped_diff, wrapped_diff, diff_square_sum);
+            prev_pair = pair;
+        }
+    }
+
+    if (sums)
+    {
+        p_acc->sum = sum;
+        p_acc->tss = tss;
+        p_acc->abssum = abssum;
+        p_acc->positive_num += halves_sum_(positive_pair);
+    }
+
+    if (extrema)
+    {
+        p_acc->min = MIN((int16_t)min_pair, (int16_t)(min_pair >> 16));
+        p_acc->max = MAX((int16_t)max_pair, (int16_t)(max_pair >> 16));
+    }
+
+    if (pairwise)
+    {
+        p_acc->prev = (int16_t)(prev_pair >> 16);
+        p_acc->zero_crossings = zero_crossings;
+        p_acc->diff_abssum = diff_abssum;
+        p_acc->diff_square_sum = diff_square_sum;
+    }
+
+    return i;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint16_t accumulate_centered_pairs_dsp_(centered_accumulator_t* p_acc,
+                                               const int16_t* p_data,
+                                               uint16_t num,
+                                               int16_t mean)
+{
+    const uint32_t mean_pair = (uint16_t)mean * PAIR_LANES_ONE;
+    uint32_t prev_diff_pair = p_acc->prev_side << 31;
+    uint32_t deviation = p_acc->deviation;
+    uint32_t mean_crossings = p_acc->mean_crossings;
+    uint16_t i = 0;
+
+    for (; (uint16_t)(num - i) >= 2; i += 2)
+    {
+        const uint32_t pair = load_pair_(&p_data[i]);
+
+        /** Bit 15 of the wrapped lanes is the side of the mean */
+        uint32_t diff_pair;
+        deviation += halves_sum_(pair_distance_(pair, mean_pair, &diff_pair));
+
+        mean_crossings += sign_changes_(prev_diff_pair, diff_pair);
+        prev_diff_pair = diff_pair;
+    }
+
+    p_acc->prev_side = prev_diff_pair >> 31;
+    p_acc->deviation = deviation;
+    p_acc->mean_crossings = mean_crossings;
+
+    return i;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+#endif
+
+static void accumulate_(const edgeai_span_t* p_span,
+                        bool sums,
+                        bool extrema,
+                        bool pairwise,
+                        edgeai_span_stats_t* p_stats)
+{
+    /** First sample is paired with itself, which adds neither a crossing nor a difference */
+    accumulator_t acc =
+    {
+        .min = INT16_MAX,
+        .max = INT16_MIN,
+        .prev = p_span->p_seg[0][0],
+    };
+
+    for (uint8_t seg = 0; seg < 2; seg++)
+    {
+        const int16_t* p_data = p_span->p_seg[seg];
+        uint16_t i = 0;
+
+#if CONFIG_EDGEAI_FEATURES_BACKEND_DSP
+        i = accumulate_pairs_dsp_(&acc, p_data, p_span->num[seg], sums, extrema, pairwise);
+#endif
+
+        for (; i < p_span->num[seg]; i++)
+        {
+            if (sums)
+                accumulate_sums_(&acc, p_data[i]);
+            if (extrema)
+                accumulate_extrema_(&acc, p_data[i]);
+            if (pairwise)
+                accumulate_pairwise_(&acc, p_data[i]);
+        }
+    }
+
+    if (sums)
+    {
+        p_stats->moments.sum = (int32_t)acc.sum;
+        p_stats->moments.tss = acc.tss;
+        p_stats->moments.abssum = acc.abssum;
+        p_stats->moments.positive_num = (uint16_t)acc.positive_num;
+    }
+
+    if (extrema)
+    {
+        p_stats->moments.min = acc.min;
+        p_stats->moments.max = acc.max;
+    }
+
+    if (pairwise)
+    {
+        /** Counters wrap as the library int16 counters */
+        p_stats->pairwise.zero_crossings = (int16_t)acc.zero_crossings;
+        p_stats->pairwise.diff_abssum = acc.diff_abssum;
+        p_stats->pairwise.diff_square_sum = acc.diff_square_sum;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void accumulate_centered_(const edgeai_span_t* p_span, int16_t mean, edgeai_span_stats_t* p_stats)
+{
+    centered_accumulator_t acc =
+    {
+        .prev_side = ((uint32_t)(p_span->p_seg[0][0] - mean) >> 15) & 1,
+    };
+
+    for (uint8_t seg = 0; seg < 2; seg++)
+    {
+        const int16_t* p_data = p_span->p_seg[seg];
+        uint16_t i = 0;
+
+#if CONFIG_EDGEAI_FEATURES_BACKEND_DSP
+        i = accumulate_centered_pairs_dsp_(&acc, p_data, p_span->num[seg], mean);
+#endif
+
+        for (; i < p_span->num[seg]; i++)
+        {
+            accumulate_centered_sample_(&acc, p_data[i], mean);
+        }
+    }
+
+    p_stats->deviation = acc.deviation;
+    p_stats->mean_crossings = (int16_t)acc.mean_crossings;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int32_t feature_min_(const edgeai_span_stats_t* p_stats)
+{
+    return p_stats->moments.min;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int32_t feature_max_(const edgeai_span_stats_t* p_stats)
+{
+    return p_stats->moments.max;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int32_t feature_range_(const edgeai_span_stats_t* p_stats)
+{
+    return (int32_t)p_stats->moments.max - p_stats->moments.min;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int32_t feature_mean_(const edgeai_span_stats_t* p_stats)
+{
+    return mean_(p_stats);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int32_t feature_mad_(const edgeai_span_stats_t* p_stats)
+{
+    return (int32_t)(p_stats->deviation / p_stats->num);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int32_t feature_std_(const edgeai_span_stats_t* p_stats)
+{
+    const int32_t mean = p_stats->moments.sum / (int32_t)p_stats->num;
+    const uint32_t var = (uint32_t)(p_stats->moments.tss / p_stats->num) - (uint32_t)(mean * mean);
+
+    return (int32_t)sqrt_u32_(var);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int32_t feature_rms_(const edgeai_span_stats_t* p_stats)
+{
+    return (int32_t)sqrt_u32_((uint32_t)(p_stats->moments.tss / p_stats->num));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int32_t feature_mcr_(const edgeai_span_stats_t* p_stats)
+{
+    return crossing_rate_(p_stats->mean_crossings, p_stats->num);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int32_t feature_zcr_(const edgeai_span_stats_t* p_stats)
+{
+    return crossing_rate_(p_stats->pairwise.zero_crossings, p_stats->num);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int32_t feature_absmean_(const edgeai_span_stats_t* p_stats)
+{
+    return (uint16_t)(p_stats->moments.abssum / p_stats->num);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int32_t feature_amdf_(const edgeai_span_stats_t* p_stats)
+{
+    const uint16_t pairs = p_stats->num - 1;
+
+    return (pairs > 0) ? (int32_t)(p_stats->pairwise.diff_abssum / pairs) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int32_t feature_psoz_(const edgeai_span_stats_t* p_stats)
+{
+    return (int16_t)(((uint32_t)p_stats->moments.positive_num * FEATURE_RATE_SCALE) / p_stats->num);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int32_t feature_rmds_(const edgeai_span_stats_t* p_stats)
+{
+    /** Squares are summed without averaging, as in the library */
+    return (int32_t)sqrt_u32_(p_stats->pairwise.diff_square_sum);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool edgeai_features_supported(nrf_edgeai_features_pipeline_func_i16_t func)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(SPAN_FEATURES_); i++)
+    {
+        if (SPAN_FEATURES_[i].library_func == func)
+            return true;
+    }
+
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool edgeai_features_plan_compile(edgeai_features_plan_t* p_plan,
+                                  const nrf_edgeai_features_pipeline_func_i16_t* p_funcs,
+                                  uint16_t funcs_num,
+                                  nrf_edgeai_features_timedomain_mask_t mask,
+                                  const uint32_t* p_consumed,
+                                  uint16_t offset)
+{
+    assert(p_plan != NULL);
+
+    nrf_edgeai_features_timedomain_mask_t used = { .all = 0 };
+
+    p_plan->offset = offset;
+    p_plan->emits_num = 0;
+    p_plan->features_num = 0;
+
+    for (uint16_t i = 0; i < funcs_num; i++)
+    {
+        size_t k = 0;
+        while ((k < ARRAY_SIZE(SPAN_FEATURES_)) && (SPAN_FEATURES_[k].library_func != p_funcs[i]))
+            k++;
+
+        if (k == ARRAY_SIZE(SPAN_FEATURES_))
+            return false;
+
+        /** Features of the mask are laid out in the pipeline order, as the library extracts them */
+        for (uint8_t j = 0; (j < FEATURE_OUTPUTS_MAX) && (SPAN_FEATURES_[k].outputs[j].emit != NULL); j++)
+        {
+            if ((mask.all & SPAN_FEATURES_[k].outputs[j].mask_bit) == 0)
+                continue;
+
+            if (p_plan->features_num == EDGEAI_FEATURES_PLAN_MAX)
+                return false;
+
+            const uint16_t feature = offset + p_plan->features_num;
+            const uint8_t slot = (uint8_t)p_plan->features_num++;
+
+            if ((p_consumed != NULL) && (((p_consumed[feature / 32] >> (feature % 32)) & 1) == 0))
+                continue;
+
+            p_plan->emits[p_plan->emits_num] = SPAN_FEATURES_[k].outputs[j].emit;
+            p_plan->slots[p_plan->emits_num++] = slot;
+            used.all |= SPAN_FEATURES_[k].outputs[j].mask_bit;
+        }
+    }
+
+    /** Passes are selected by the computed features of the plan only */
+    p_plan->is_sums_needed = needs_sums_(used);
+    p_plan->is_extrema_needed = needs_extrema_(used);
+    p_plan->is_pairwise_needed = needs_pairwise_(used);
+    p_plan->is_centered_needed = used.is.mad || used.is.mcr;
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint16_t edgeai_features_extract(const edgeai_features_plan_t* p_plan,
+                                 const edgeai_span_t* p_span,
+                                 const edgeai_stat_ctx_t* p_moments,
+                                 const edgeai_extrema_t* p_extrema,
+                                 const edgeai_pairwise_t* p_pairwise,
+                                 int32_t* p_features)
+{
+    assert(p_span->num[0] > 0);
+
+    edgeai_span_stats_t stats;
+    int32_t* p_plan_features = &p_features[p_plan->offset];
+
+    stats.num = span_num_(p_span);
+
+    /** One accumulating pass for the statistics not precomputed */
+    const bool sums = p_plan->is_sums_needed && (p_moments == NULL);
+    const bool extrema = p_plan->is_extrema_needed && (p_moments == NULL) && (p_extrema == NULL);
+    const bool pairwise = p_plan->is_pairwise_needed && (p_pairwise == NULL);
+
+    if (p_moments != NULL)
+    {
+        stats.moments = *p_moments;
+    }
+    else if (p_extrema != NULL)
+    {
+        stats.moments.min = p_extrema->min;
+        stats.moments.max = p_extrema->max;
+    }
+
+    if (p_pairwise != NULL)
+        stats.pairwise = *p_pairwise;
+
+    if (sums || extrema || pairwise)
+        accumulate_(p_span, sums, extrema, pairwise, &stats);
+
+    /** One more pass for the features depending on the mean */
+    if (p_plan->is_centered_needed)
+        accumulate_centered_(p_span, mean_(&stats), &stats);
+
+    for (uint16_t i = 0; i < p_plan->emits_num; i++)
+    {
+        p_plan_features[p_plan->slots[i]] = p_plan->emits[i](&stats);
+    }
+
+    return p_plan->emits_num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_features_scale_q16(int32_t* p_features, uint16_t num, const int32_t* p_min, const int32_t* p_max)
+{
+    /** Q16 value of the feature i is stored over the low half of the feature i / 2, which is already consumed */
+    uint16_t* p_q16 = (uint16_t*)p_features;
+
+    for (uint16_t i = 0; i < num; i++)
+    {
+        const int32_t value = CLAMP(p_features[i], p_min[i], p_max[i]);
+        const uint32_t range = (uint32_t)(p_max[i] - p_min[i]);
+        const uint32_t offset = (uint32_t)(value - p_min[i]);
+
+        p_q16[i] = (range > 0) ? (uint16_t)((offset * UINT16_MAX) / range) : 0;
+    }
+}
@@ -0,0 +1,186 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+#ifndef EDGEAI_FEATURES_H__
+#define EDGEAI_FEATURES_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <nrf_edgeai/rt/nrf_edgeai_dsp_pipeline_types.h>
+
+#include "edgeai_window.h"
+
+/**
+ * @brief Moments of the span samples shared by the time-domain features of one axis
+ */
+typedef struct edgeai_stat_ctx_s
+{
+    /** Sum of samples */
+    int32_t sum;
+
+    /** Total sum of squares of samples */
+    uint64_t tss;
+
+    /** Sum of absolute values of samples */
+    uint32_t abssum;
+
+    /** Number of positive samples */
+    uint16_t positive_num;
+
+    /** Minimum and maximum of samples */
+    int16_t min;
+    int16_t max;
+} edgeai_stat_ctx_t;
+
+/**
+ * @brief Minimum and maximum of the span samples
+ */
+typedef struct edgeai_extrema_s
+{
+    int16_t min;
+    int16_t max;
+} edgeai_extrema_t;
+
+/**
+ * @brief Statistics of the neighbor samples pairs of the span
+ */
+typedef struct edgeai_pairwise_s
+{
+    /** Number of sign changes between neighbor samples, wraps as the library int16 counter */
+    int16_t zero_crossings;
+
+    /** Sum of absolute differences of neighbor samples */
+    uint32_t diff_abssum;
+
+    /** Sum of squares of neighbor samples differences wrapped to int16 */
+    uint32_t diff_square_sum;
+} edgeai_pairwise_t;
+
+/**
+ * @brief Statistics of the span computed by the fused passes over the samples,
+ *        only the statistics needed by the features mask are valid
+ */
+typedef struct edgeai_span_stats_s
+{
+    /** Number of samples */
+    uint16_t num;
+
+    /** Moments of samples */
+    edgeai_stat_ctx_t moments;
+
+    /** Statistics of neighbor samples */
+    edgeai_pairwise_t pairwise;
+
+    /** Sum of absolute deviations from the mean */
+    uint32_t deviation;
+
+    /** Number of mean crossings between neighbor samples */
+    int16_t mean_crossings;
+} edgeai_span_stats_t;
+
+/** Max number of features of one axis plan */
+#define EDGEAI_FEATURES_PLAN_MAX  (16)
+
+/**
+ * @brief Time-domain feature derived from the span statistics
+ *
+ * @param[in] p_stats  Span statistics
+ *
+ * @return Feature value
+ */
+typedef int32_t (*edgeai_feature_emit_t)(const edgeai_span_stats_t* p_stats);
+
+/**
+ * @brief Time-domain features extraction plan of one axis, compiled from the axis features mask
+ */
+typedef struct edgeai_features_plan_s
+{
+    /** Computed features of the mask in the extracted features order, and their positions
+     *  among the axis features */
+    edgeai_feature_emit_t emits[EDGEAI_FEATURES_PLAN_MAX];
+    uint8_t slots[EDGEAI_FEATURES_PLAN_MAX];
+    uint16_t emits_num;
+
+    /** Number of features of the mask, computed or not */
+    uint16_t features_num;
+
+    /** Offset of the axis features in the extracted features */
+    uint16_t offset;
+
+    /** Statistics passes needed by the features, sums include the moments but min and max */
+    bool is_sums_needed;
+    bool is_extrema_needed;
+    bool is_pairwise_needed;
+    bool is_centered_needed;
+} edgeai_features_plan_t;
+
+/**
+ * @brief Check that the library int16 time-domain feature function is supported by the plans.
+ *        Plans produce bit-exact library results.
+ *
+ * @param[in] func  Library feature function from the generated features pipeline
+ *
+ * @return true if supported
+ */
+bool edgeai_features_supported(nrf_edgeai_features_pipeline_func_i16_t func);
+
+/**
+ * @brief Compile features extraction plan of one axis.
+ *
+ * Only the features set in the mask are kept, so the extraction neither tests the mask
+ * nor calls the pipeline functions without features of the axis. Features not consumed
+ * by the model are not computed, nor the statistics needed by them only, their values
+ * in the extracted features are left as they are.
+ *
+ * @param[out] p_plan      Axis plan
+ * @param[in]  p_funcs     Library time-domain features pipeline functions
+ * @param[in]  funcs_num   Number of pipeline functions
+ * @param[in]  mask        Time-domain features mask of the axis
+ * @param[in]  p_consumed  Bitmap of the extracted features consumed by the model, feature i is
+ *                         bit i % 32 of word i / 32, NULL to compute every feature of the mask
+ * @param[in]  offset      Offset of the axis features in the extracted features
+ *
+ * @return true on success, false if a function is not supported or the axis has too many features
+ */
+bool edgeai_features_plan_compile(edgeai_features_plan_t* p_plan,
+                                  const nrf_edgeai_features_pipeline_func_i16_t* p_funcs,
+                                  uint16_t funcs_num,
+                                  nrf_edgeai_features_timedomain_mask_t mask,
+                                  const uint32_t* p_consumed,
+                                  uint16_t offset);
+
+/**
+ * @brief Extract time-domain features of one axis by its plan.
+ *
+ * Statistics of the plan features are computed together, by one accumulating
+ * pass over the samples and one more pass for the mean dependent features.
+ *
+ * @param[in]  p_plan      Axis plan
+ * @param[in]  p_span      Axis samples span, at least one sample
+ * @param[in]  p_moments   Precomputed moments of the span, NULL to compute them from the samples
+ * @param[in]  p_extrema   Precomputed minimum and maximum of the span, used when the moments
+ *                         are not precomputed, NULL to compute them from the samples
+ * @param[in]  p_pairwise  Precomputed neighbor samples statistics of the span, NULL to compute them from the samples
+ * @param[out] p_features  Extracted features of all axes, the axis features are stored at the plan offset
+ *
+ * @return Number of computed features
+ */
+uint16_t edgeai_features_extract(const edgeai_features_plan_t* p_plan,
+                                 const edgeai_span_t* p_span,
+                                 const edgeai_stat_ctx_t* p_moments,
+                                 const edgeai_extrema_t* p_extrema,
+                                 const edgeai_pairwise_t* p_pairwise,
+                                 int32_t* p_features);
+
+/**
+ * @brief Scale extracted features to Q16 model inputs with per-feature min/max, in place
+ *
+ * @param[in,out] p_features  Extracted features on input, Q16 values stored as uint16_t on output
+ * @param[in]     num         Number of features
+ * @param[in]     p_min       Features minimum values
+ * @param[in]     p_max       Features maximum values
+ */
+void edgeai_features_scale_q16(int32_t* p_features, uint16_t num, const int32_t* p_min, const int32_t* p_max);
+
+#endif /* EDGEAI_FEATURES_H__ */
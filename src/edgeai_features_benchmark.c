@@ -0,0 +1,141 @@
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_benchmark.h"
+#include "edgeai_runtime_private.h"
+#include "edgeai_window.h"
+#include "edgeai_features.h"
+
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <nrf_edgeai/rt/private/nrf_edgeai_interfaces.h>
+#include <zephyr/kernel.h>
+
+/**
+ * Features extraction benchmark, compiled with CONFIG_EDGEAI_FEATURES_BENCHMARK only.
+ */
+
+///
+/** Max number of axes of the benchmark window */
+#define BENCHMARK_AXES_MAX          (8)
+
+/** Max number of extracted features compared with the library features */
+#define BENCHMARK_FEATURES_MAX      (BENCHMARK_AXES_MAX * EDGEAI_FEATURES_PLAN_MAX)
+///
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Library features of the benchmark window */
+static uint16_t benchmark_features_[BENCHMARK_FEATURES_MAX];
+
+//////////////////////////////////////////////////////////////////////////////
+
+static bool features_equal_(const uint16_t* p_expected,
+                            const uint16_t* p_features,
+                            uint16_t features_num,
+                            const uint32_t* p_consumed)
+{
+    /** Features not computed keep stale values, only the consumed ones are compared */
+    for (uint16_t i = 0; i < features_num; i++)
+    {
+        if (((p_consumed == NULL) || ((p_consumed[i / 32] >> (i % 32)) & 1)) && (p_expected[i] != p_features[i]))
+            return false;
+    }
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t plans_cycles_(nrf_edgeai_t* p_edgeai, uint16_t runs)
+{
+    /** Runtime extraction interface runs the plans */
+    const uint32_t start = k_cycle_get_32();
+    for (uint16_t i = 0; i < runs; i++)
+    {
+        p_edgeai->interfaces.process_features(&p_edgeai->input, p_edgeai->p_dsp);
+    }
+
+    return (k_cycle_get_32() - start) / runs;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+nrf_edgeai_err_t edgeai_benchmark_features(nrf_edgeai_t* p_edgeai,
+                                           uint16_t runs,
+                                           edgeai_features_benchmark_t* p_result)
+{
+    assert((runs > 0) && (p_result != NULL));
+
+    edgeai_window_t* p_window = edgeai_runtime_window(p_edgeai);
+    edgeai_runtime_features_info_t info;
+    edgeai_runtime_features_info(&info);
+
+    if ((p_window == NULL) || (p_edgeai->input.unique_num > BENCHMARK_AXES_MAX) ||
+        (info.features_num > BENCHMARK_FEATURES_MAX))
+        return NRF_EDGEAI_ERR_NOT_SUPPORTED;
+
+    nrf_edgeai_input_t* p_input = &p_edgeai->input;
+    int32_t* p_extracted = p_edgeai->p_dsp->features.extracted_memory.p_i32;
+    const uint16_t size = p_input->window_size;
+    int16_t frame[BENCHMARK_AXES_MAX];
+    uint32_t seed = 1;
+
+    /** Window of pseudo-random samples, every run computes the window statistics from the samples,
+     *  as the library does */
+    edgeai_runtime_window_reset(false);
+    for (uint16_t i = 0; i < size; i++)
+    {
+        for (uint16_t axis = 0; axis < p_input->unique_num; axis++)
+        {
+            seed = seed * 1664525U + 1013904223U;
+            frame[axis] = (int16_t)(seed >> 16);
+        }
+        edgeai_window_push(p_window, frame, 1);
+    }
+
+    /** Library extracts the features from the linear window in the model window memory */
+    for (uint16_t axis = 0; axis < p_input->unique_num; axis++)
+    {
+        int16_t* p_column = &p_input->window_memory.p_i16[axis * size];
+        edgeai_span_t span;
+        edgeai_window_span(p_window, axis, &span);
+
+        memmove(p_column, span.p_seg[0], span.num[0] * sizeof(int16_t));
+        if (span.num[1] > 0)
+            memmove(&p_column[span.num[0]], span.p_seg[1], span.num[1] * sizeof(int16_t));
+    }
+
+    /** Library calls every pipeline function for every axis, each function tests the axis mask */
+    const uint32_t start = k_cycle_get_32();
+    for (uint16_t i = 0; i < runs; i++)
+    {
+        nrf_edgeai_process_features_dsp_i16_q16(p_input, p_edgeai->p_dsp);
+    }
+    p_result->library_cycles = (k_cycle_get_32() - start) / runs;
+    memcpy(benchmark_features_, p_extracted, info.features_num * sizeof(uint16_t));
+
+    const uint16_t* p_features = (const uint16_t*)p_extracted;
+
+    p_result->plans_cycles = plans_cycles_(p_edgeai, runs);
+    p_result->is_bit_exact = features_equal_(benchmark_features_, p_features, info.features_num, info.p_consumed);
+    p_result->features_num = info.features_num;
+    p_result->pruned_num = info.pruned_num;
+    p_result->unpruned_cycles = p_result->plans_cycles;
+
+    /** Plans of every feature of the masks, as without the pruning, are compiled for the benchmark only */
+    if (info.pruned_num > 0)
+    {
+        edgeai_runtime_plans_compile(p_edgeai, false);
+        p_result->unpruned_cycles = plans_cycles_(p_edgeai, runs);
+        p_result->is_bit_exact = p_result->is_bit_exact &&
+                                 features_equal_(benchmark_features_, p_features, info.features_num, NULL);
+        edgeai_runtime_plans_compile(p_edgeai, true);
+    }
+
+    /** Benchmark window is dropped */
+    edgeai_runtime_window_reset(true);
+
+    return NRF_EDGEAI_ERR_SUCCESS;
+}
@@ -0,0 +1,139 @@
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_benchmark.h"
+#include "edgeai_model_unrolled.h"
+#include "edgeai_model_packed.h"
+#include "edgeai_neuton.h"
+
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <nrf_edgeai/rt/private/nrf_edgeai_interfaces.h>
+#include <zephyr/kernel.h>
+
+/**
+ * Model inference benchmark, compiled with CONFIG_EDGEAI_INFERENCE_BENCHMARK only.
+ */
+
+///
+/** Max number of model neurons compared by the inference benchmark */
+#define BENCHMARK_NEURONS_MAX       (64)
+
+/** Number of sigmoid arguments of the activation benchmark */
+#define BENCHMARK_SIGMOIDS_NUM      (64)
+///
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Library neurons of the benchmark inputs */
+static uint16_t benchmark_neurons_[BENCHMARK_NEURONS_MAX];
+
+/** Links sums of the activation benchmark */
+static int64_t benchmark_accs_[BENCHMARK_SIGMOIDS_NUM];
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t inference_cycles_(nrf_edgeai_t* p_edgeai, nrf_edgeai_iface_run_inference_t run_inference, uint16_t runs)
+{
+    const uint32_t start = k_cycle_get_32();
+    for (uint16_t i = 0; i < runs; i++)
+    {
+        run_inference(p_edgeai);
+    }
+
+    return (k_cycle_get_32() - start) / runs;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t sigmoid_cycles_(uint16_t (*sigmoid)(uint16_t, int64_t),
+                                const uint16_t* p_weights,
+                                uint16_t weights_num,
+                                uint16_t runs,
+                                uint32_t* p_checksum)
+{
+    uint32_t checksum = 0;
+
+    const uint32_t start = k_cycle_get_32();
+    for (uint16_t i = 0; i < runs; i++)
+    {
+        for (uint16_t j = 0; j < BENCHMARK_SIGMOIDS_NUM; j++)
+        {
+            checksum = checksum * 31 + sigmoid(p_weights[j % weights_num], benchmark_accs_[j]);
+        }
+    }
+    const uint32_t cycles = (k_cycle_get_32() - start) / ((uint32_t)runs * BENCHMARK_SIGMOIDS_NUM);
+
+    *p_checksum = checksum;
+
+    return cycles;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+nrf_edgeai_err_t edgeai_benchmark_inference(nrf_edgeai_t* p_edgeai,
+                                            uint16_t runs,
+                                            edgeai_inference_benchmark_t* p_result)
+{
+    assert((runs > 0) && (p_result != NULL));
+
+    const nrf_edgeai_model_meta_t* p_meta = &p_edgeai->model.meta;
+    const uint16_t* p_neurons = p_edgeai->model.params.q16.p_neurons;
+    const size_t neurons_size = p_meta->neurons_num * sizeof(uint16_t);
+
+    if (!edgeai_model_unrolled_supported(p_edgeai) || !edgeai_model_packed_supported(p_edgeai) ||
+        (p_meta->neurons_num > BENCHMARK_NEURONS_MAX))
+        return NRF_EDGEAI_ERR_NOT_SUPPORTED;
+
+    /** Pseudo-random Q16 inputs where the library takes them */
+    uint16_t* p_inputs;
+    uint32_t inputs_num;
+    if (p_meta->uses_as_input.features.input)
+    {
+        p_inputs = p_edgeai->input.window_memory.p_void;
+        inputs_num = (uint32_t)p_edgeai->input.unique_num_used * p_edgeai->input.window_size;
+    }
+    else
+    {
+        p_inputs = p_edgeai->p_dsp->features.extracted_memory.p_void;
+        inputs_num = p_edgeai->p_dsp->features.overall_num;
+    }
+
+    uint32_t seed = 1;
+    for (uint32_t i = 0; i < inputs_num; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        p_inputs[i] = (uint16_t)(seed >> 16);
+    }
+
+    p_result->library_cycles = inference_cycles_(p_edgeai, nrf_edgeai_run_model_inference_q16, runs);
+    memcpy(benchmark_neurons_, p_neurons, neurons_size);
+
+    p_result->packed_cycles = inference_cycles_(p_edgeai, edgeai_model_packed_run_inference_q16, runs);
+    p_result->is_bit_exact = (memcmp(benchmark_neurons_, p_neurons, neurons_size) == 0);
+
+    p_result->unrolled_cycles = inference_cycles_(p_edgeai, edgeai_model_unrolled_run_inference_q16, runs);
+    p_result->is_bit_exact = p_result->is_bit_exact && (memcmp(benchmark_neurons_, p_neurons, neurons_size) == 0);
+
+    p_result->library_size = edgeai_neuton_graph_size_q16(&p_edgeai->model);
+    p_result->packed_size = edgeai_model_packed.stream_size;
+
+    /** Sigmoid arguments of all magnitudes, with the model activation weights */
+    for (uint16_t i = 0; i < BENCHMARK_SIGMOIDS_NUM; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        benchmark_accs_[i] = (int64_t)(int32_t)seed >> (i % 24);
+    }
+
+    uint32_t ref_checksum;
+    uint32_t lut_checksum;
+    const uint16_t* p_act_weights = p_edgeai->model.params.q16.p_act_weights;
+    p_result->sigmoid_ref_cycles =
+        sigmoid_cycles_(edgeai_neuton_sigmoid_ref_q16, p_act_weights, p_meta->neurons_num, runs, &ref_checksum);
+    p_result->sigmoid_lut_cycles =
+        sigmoid_cycles_(edgeai_neuton_sigmoid_lut_q16, p_act_weights, p_meta->neurons_num, runs, &lut_checksum);
+    p_result->is_bit_exact = p_result->is_bit_exact && (ref_checksum == lut_checksum);
+
+    return NRF_EDGEAI_ERR_SUCCESS;
+}
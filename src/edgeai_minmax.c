@@ -0,0 +1,135 @@
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_minmax.h"
+
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline int16_t span_value_(const edgeai_span_t* p_span, uint16_t offset)
+{
+    if (offset < p_span->num[0])
+        return p_span->p_seg[0][offset];
+
+    return p_span->p_seg[1][offset - p_span->num[0]];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint16_t deque_index_(const edgeai_minmax_t* p_minmax, uint16_t head, uint16_t i)
+{
+    const uint16_t index = head + i;
+
+    return (index >= p_minmax->capacity) ? (index - p_minmax->capacity) : index;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void deque_push_(const edgeai_minmax_t* p_minmax,
+                        uint16_t* p_positions,
+                        uint16_t head,
+                        uint16_t* p_num,
+                        const edgeai_span_t* p_span,
+                        uint16_t start,
+                        uint16_t offset,
+                        bool is_max)
+{
+    const int16_t value = span_value_(p_span, offset);
+
+    /** Candidates not better than the new sample never become the window extremum again */
+    while (*p_num > 0)
+    {
+        const uint16_t back = p_positions[deque_index_(p_minmax, head, *p_num - 1)];
+        const int16_t back_value = span_value_(p_span, (uint16_t)(back - start));
+
+        if (is_max ? (back_value > value) : (back_value < value))
+            break;
+
+        (*p_num)--;
+    }
+
+    p_positions[deque_index_(p_minmax, head, *p_num)] = (uint16_t)(start + offset);
+    (*p_num)++;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void deque_expire_(const edgeai_minmax_t* p_minmax,
+                          const uint16_t* p_positions,
+                          uint16_t* p_head,
+                          uint16_t* p_num,
+                          uint16_t start,
+                          uint16_t window_num)
+{
+    /** Positions before the window start wrap to offsets past the window end */
+    while ((*p_num > 0) && ((uint16_t)(p_positions[*p_head] - start) >= window_num))
+    {
+        *p_head = deque_index_(p_minmax, *p_head, 1);
+        (*p_num)--;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_minmax_init(edgeai_minmax_t* p_minmax, uint16_t* p_positions, uint16_t capacity)
+{
+    assert(p_minmax != NULL);
+    assert(p_positions != NULL);
+    assert(capacity > 0);
+
+    p_minmax->p_min_positions = p_positions;
+    p_minmax->p_max_positions = &p_positions[capacity];
+    p_minmax->capacity = capacity;
+
+    edgeai_minmax_reset(p_minmax);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_minmax_reset(edgeai_minmax_t* p_minmax)
+{
+    p_minmax->min_head = 0;
+    p_minmax->min_num = 0;
+    p_minmax->max_head = 0;
+    p_minmax->max_num = 0;
+    p_minmax->next = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_minmax_window(edgeai_minmax_t* p_minmax,
+                          const edgeai_span_t* p_span,
+                          uint32_t start,
+                          edgeai_extrema_t* p_extrema)
+{
+    const uint16_t window_num = p_span->num[0] + p_span->num[1];
+
+    assert((window_num > 0) && (window_num <= p_minmax->capacity));
+
+    /** Window past the tracked samples starts over */
+    if ((uint32_t)(p_minmax->next - start) > window_num)
+    {
+        edgeai_minmax_reset(p_minmax);
+        p_minmax->next = start;
+    }
+
+    /** Samples that left the window are dropped first, the rest of the candidates are in the span */
+    deque_expire_(p_minmax, p_minmax->p_min_positions, &p_minmax->min_head, &p_minmax->min_num,
+                  (uint16_t)start, window_num);
+    deque_expire_(p_minmax, p_minmax->p_max_positions, &p_minmax->max_head, &p_minmax->max_num,
+                  (uint16_t)start, window_num);
+
+    for (uint16_t offset = (uint16_t)(p_minmax->next - start); offset < window_num; offset++)
+    {
+        deque_push_(p_minmax, p_minmax->p_min_positions, p_minmax->min_head, &p_minmax->min_num,
+                    p_span, (uint16_t)start, offset, false);
+        deque_push_(p_minmax, p_minmax->p_max_positions, p_minmax->max_head, &p_minmax->max_num,
+                    p_span, (uint16_t)start, offset, true);
+    }
+    p_minmax->next = start + window_num;
+
+    p_extrema->min = span_value_(p_span, (uint16_t)(p_minmax->p_min_positions[p_minmax->min_head] - start));
+    p_extrema->max = span_value_(p_span, (uint16_t)(p_minmax->p_max_positions[p_minmax->max_head] - start));
+}
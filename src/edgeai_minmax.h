@@ -0,0 +1,74 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+#ifndef EDGEAI_MINMAX_H__
+#define EDGEAI_MINMAX_H__
+
+#include <stdint.h>
+
+#include "edgeai_features.h"
+
+/**
+ * @brief Streaming minimum and maximum of the sliding window of one axis.
+ *
+ * Monotonic deques keep the stream positions of the samples that may still become
+ * the window minimum or maximum, oldest first. Each sample is added and removed
+ * at most once, so the cost per window is the number of new samples, amortized,
+ * and the minimum and maximum are read from the deque fronts.
+ */
+typedef struct edgeai_minmax_s
+{
+    /** Positions of the minimum candidates with increasing values, low 16 bits of stream positions */
+    uint16_t* p_min_positions;
+
+    /** Positions of the maximum candidates with decreasing values */
+    uint16_t* p_max_positions;
+
+    /** Deques capacity, at least the window size */
+    uint16_t capacity;
+
+    uint16_t min_head;
+    uint16_t min_num;
+    uint16_t max_head;
+    uint16_t max_num;
+
+    /** Stream position of the next sample taken into the deques */
+    uint32_t next;
+} edgeai_minmax_t;
+
+/**
+ * @brief Initialize min/max tracker
+ *
+ * @param[in] p_minmax     Pointer to the tracker context
+ * @param[in] p_positions  Deques storage, 2 * capacity entries
+ * @param[in] capacity     Deques capacity, at least the window size
+ */
+void edgeai_minmax_init(edgeai_minmax_t* p_minmax, uint16_t* p_positions, uint16_t capacity);
+
+/**
+ * @brief Drop the tracked samples, the next window is taken from its start.
+ *        Needed when the stream positions restart.
+ *
+ * @param[in] p_minmax  Pointer to the tracker context
+ */
+void edgeai_minmax_reset(edgeai_minmax_t* p_minmax);
+
+/**
+ * @brief Get minimum and maximum of the window.
+ *
+ * Samples added since the previous window are taken into the deques, samples that left
+ * the window are dropped. Window that does not overlap the samples taken so far is
+ * taken from its start.
+ *
+ * @param[in]  p_minmax    Pointer to the tracker context
+ * @param[in]  p_span      Window span, at least one sample
+ * @param[in]  start       Stream position of the first window sample, not below the previous windows
+ * @param[out] p_extrema   Window minimum and maximum
+ */
+void edgeai_minmax_window(edgeai_minmax_t* p_minmax,
+                          const edgeai_span_t* p_span,
+                          uint32_t start,
+                          edgeai_extrema_t* p_extrema);
+
+#endif /* EDGEAI_MINMAX_H__ */
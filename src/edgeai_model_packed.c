@@ -0,0 +1,150 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+/* Generated by scripts/neuton_codegen.py from src/nrf_edgeai_lib/nrf_edgeai_generated/nrf_edgeai_user_model.c, do not edit */
+
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_model_packed.h"
+#include "edgeai_neuton.h"
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Model the code is generated from */
+static const edgeai_neuton_model_id_t model_id_ = {
+    .p_solution_id = "84622",
+    .graph_hash    = 0x3CD69397u,
+    .neurons_num   = 25,
+    .weights_num   = 217,
+    .inputs_num    = 52,
+    .uses_as_input = 0x02,
+};
+
+/** Neuron records, 776 bytes, the library encoding takes 1022 bytes */
+static const uint8_t model_stream_[] = {
+    /* Neuron 0 */
+    0x00, 0x0B, 0x01, 0x01, 0x00, 0x00, 0x00, 0x17, 0xE3, 0x01, 0x5A, 0x36,
+    0x12, 0xFB, 0x7F, 0x18, 0x62, 0xE8, 0x1D, 0x76, 0x80, 0x1E, 0x4C, 0x75,
+    0x21, 0x0C, 0x7F, 0x23, 0x24, 0xF3, 0x30, 0xFE, 0x7F, 0x31, 0xFB, 0x7F,
+    0x32, 0xC7, 0x1B, 0xE4, 0x70,
+    /* Neuron 1 */
+    0x00, 0x0D, 0x01, 0x01, 0x00, 0x00, 0x02, 0x43, 0xE0, 0x05, 0xFC, 0x7F,
+    0x06, 0xED, 0x9F, 0x07, 0x73, 0x08, 0x0B, 0x3A, 0x1E, 0x0C, 0x14, 0xD5,
+    0x0F, 0x76, 0x2B, 0x11, 0xE1, 0xF6, 0x14, 0x48, 0x06, 0x19, 0x54, 0x1E,
+    0x20, 0xCA, 0xCE, 0x2E, 0x40, 0x79, 0x32, 0x5A, 0xB5, 0xCE, 0xCA,
+    /* Neuron 2 */
+    0x01, 0x09, 0x01, 0x01, 0x00, 0x00, 0x01, 0x05, 0x41, 0x00, 0xDB, 0xF3,
+    0x11, 0x51, 0xFB, 0x13, 0xC6, 0x98, 0x15, 0xAF, 0xF0, 0x21, 0xE2, 0xCC,
+    0x26, 0xFC, 0x57, 0x27, 0xDA, 0x67, 0x2D, 0x09, 0x19, 0x2F, 0xAE, 0xAB,
+    0x2A, 0xBD,
+    /* Neuron 3 */
+    0x03, 0x0F, 0x01, 0x01, 0x00, 0x00, 0x00, 0xDD, 0x15, 0x01, 0x1A, 0x80,
+    0x02, 0xBB, 0x4A, 0x02, 0x62, 0x58, 0x04, 0xDB, 0xAD, 0x08, 0x0B, 0x08,
+    0x0C, 0xF8, 0x50, 0x0D, 0x6F, 0x2C, 0x0F, 0x46, 0x20, 0x12, 0x9E, 0x3F,
+    0x15, 0x96, 0x2F, 0x17, 0x9E, 0x16, 0x1B, 0x90, 0xDB, 0x26, 0xFC, 0x7F,
+    0x27, 0x71, 0x56, 0x29, 0x4D, 0x83, 0x2D, 0xFD, 0x7F, 0x33, 0x2E, 0x70,
+    0xE3, 0xD9,
+    /* Neuron 4 */
+    0x00, 0x15, 0x01, 0x01, 0x00, 0x00, 0x00, 0x7D, 0xB6, 0x03, 0x44, 0x51,
+    0x04, 0x0A, 0x3C, 0x06, 0xDF, 0x84, 0x0A, 0x22, 0xB5, 0x0B, 0xA1, 0x75,
+    0x0E, 0x23, 0x35, 0x11, 0x87, 0xD2, 0x12, 0x5E, 0x05, 0x13, 0x39, 0xA7,
+    0x14, 0xFF, 0x7F, 0x16, 0x75, 0xE3, 0x1A, 0xAC, 0x9F, 0x1C, 0x36, 0x09,
+    0x1E, 0xEB, 0x66, 0x25, 0x16, 0x19, 0x29, 0x5B, 0xA4, 0x2A, 0xB8, 0x63,
+    0x2B, 0xBF, 0xC1, 0x2C, 0x4F, 0x8A, 0x2F, 0xC2, 0x36, 0xD2, 0x86,
+    /* Neuron 5 */
+    0x00, 0x11, 0x01, 0x01, 0x00, 0x00, 0x00, 0x7C, 0x07, 0x05, 0x65, 0x7D,
+    0x06, 0xE3, 0x62, 0x07, 0x68, 0xE9, 0x09, 0x39, 0xD9, 0x0B, 0x32, 0xA4,
+    0x0C, 0x42, 0x28, 0x13, 0xFF, 0x7F, 0x14, 0xBF, 0xA8, 0x16, 0xE2, 0xD6,
+    0x19, 0xE3, 0x5C, 0x1A, 0x43, 0x19, 0x1B, 0x76, 0xC9, 0x24, 0x60, 0x0A,
+    0x27, 0x2F, 0x72, 0x30, 0xFE, 0x7F, 0x31, 0x80, 0x7E, 0x26, 0x74,
+    /* Neuron 6 */
+    0x01, 0x0E, 0x01, 0x01, 0x00, 0x00, 0x01, 0x88, 0xF5, 0x01, 0x37, 0x62,
+    0x02, 0xA6, 0xFE, 0x04, 0x63, 0x3D, 0x05, 0xFE, 0xCF, 0x08, 0x9A, 0xF4,
+    0x09, 0xFD, 0x7F, 0x0C, 0x10, 0x7F, 0x0D, 0x20, 0xA3, 0x10, 0x2C, 0x49,
+    0x1E, 0xB0, 0x6B, 0x1F, 0x4C, 0x6E, 0x21, 0x14, 0xF2, 0x2A, 0xFD, 0x7F,
+    0x2D, 0xAB, 0x2B, 0x09, 0xA3,
+    /* Neuron 7 */
+    0x01, 0x04, 0x01, 0x01, 0x00, 0x00, 0x06, 0xF2, 0x2B, 0x06, 0x2A, 0x60,
+    0x08, 0xD1, 0x15, 0x0D, 0x5D, 0xE6, 0x1F, 0x6D, 0x80, 0x61, 0x2D,
+    /* Neuron 8 */
+    0x03, 0x07, 0x01, 0x01, 0x00, 0x2C, 0x01, 0x42, 0xBF, 0x04, 0xEF, 0x82,
+    0x06, 0x42, 0x01, 0x00, 0xFC, 0xE8, 0x02, 0xED, 0x0B, 0x07, 0xE4, 0x45,
+    0x0B, 0xAF, 0x20, 0x0C, 0x17, 0x12, 0x11, 0x6C, 0xED, 0x23, 0x21, 0x37,
+    0x64, 0x0D,
+    /* Neuron 9 */
+    0x01, 0x06, 0x01, 0x01, 0x00, 0xFC, 0x01, 0x63, 0x6C, 0x00, 0x44, 0xFF,
+    0x05, 0x16, 0x3B, 0x0A, 0x6F, 0x2B, 0x0F, 0x4D, 0x23, 0x28, 0x01, 0xC0,
+    0x29, 0x02, 0x80, 0x6A, 0xA8,
+    /* Neuron 10 */
+    0x02, 0x00, 0x01, 0x00, 0xFF, 0x9F, 0x00, 0x00, 0x80, 0x09, 0xFE, 0x7F,
+    0x5F, 0x06,
+    /* Neuron 11 */
+    0x01, 0x00, 0x01, 0x01, 0x00, 0xEC, 0x02, 0xEC, 0x7B, 0xF0, 0xD9,
+    /* Neuron 12 */
+    0x02, 0x00, 0x01, 0x00, 0xFF, 0x9F, 0x02, 0xFD, 0x7F, 0x0B, 0xFF, 0x7F,
+    0x0E, 0xC1,
+    /* Neuron 13 */
+    0x01, 0x00, 0x01, 0x01, 0x00, 0xF8, 0x03, 0xFE, 0x7F, 0x9B, 0xCE,
+    /* Neuron 14 */
+    0x02, 0x00, 0x01, 0x00, 0x00, 0xA0, 0x03, 0x00, 0x80, 0x0D, 0x00, 0x80,
+    0x2C, 0x53,
+    /* Neuron 15 */
+    0x03, 0x03, 0x01, 0x01, 0x00, 0xEC, 0x04, 0x02, 0x80, 0x05, 0x87, 0x0A,
+    0x09, 0xFE, 0x7F, 0x01, 0x57, 0x31, 0x1D, 0x51, 0x26, 0x2B, 0x04, 0xBD,
+    0x7E, 0xF7,
+    /* Neuron 16 */
+    0x02, 0x00, 0x01, 0x00, 0xFB, 0x9F, 0x04, 0xFD, 0x7F, 0x0F, 0x00, 0x80,
+    0x19, 0xDE,
+    /* Neuron 17 */
+    0x03, 0x08, 0x01, 0x01, 0x00, 0x40, 0x01, 0x77, 0xC1, 0x05, 0x29, 0x7F,
+    0x09, 0xFE, 0x7F, 0x06, 0xB1, 0x0B, 0x0A, 0x5D, 0x1F, 0x0F, 0xE5, 0x64,
+    0x13, 0xFF, 0x3F, 0x19, 0x3C, 0x70, 0x2C, 0xFF, 0x7F, 0x2E, 0xB0, 0x80,
+    0x30, 0xFE, 0x7F, 0x3F, 0x0B,
+    /* Neuron 18 */
+    0x02, 0x00, 0x01, 0x00, 0x00, 0xA0, 0x05, 0x3E, 0x8E, 0x11, 0x00, 0x80,
+    0x86, 0x53,
+    /* Neuron 19 */
+    0x01, 0x06, 0x01, 0x01, 0x00, 0x00, 0x07, 0x9E, 0x91, 0x05, 0x4E, 0x4D,
+    0x10, 0xB7, 0x5B, 0x1D, 0x94, 0x34, 0x1F, 0xD1, 0x7E, 0x21, 0xC1, 0xBA,
+    0x33, 0xA0, 0x2D, 0x7A, 0x8F,
+    /* Neuron 20 */
+    0x02, 0x00, 0x01, 0x00, 0x00, 0xA0, 0x06, 0x00, 0x80, 0x13, 0x00, 0x80,
+    0x1D, 0x21,
+    /* Neuron 21 */
+    0x04, 0x08, 0x01, 0x01, 0x00, 0xEC, 0x02, 0x4F, 0x19, 0x07, 0x5E, 0x86,
+    0x08, 0x3E, 0x97, 0x13, 0xFB, 0x20, 0x01, 0x6F, 0x25, 0x07, 0xFD, 0xDE,
+    0x09, 0xDC, 0xFB, 0x0F, 0x45, 0x01, 0x15, 0xEF, 0xDA, 0x1F, 0x00, 0x25,
+    0x22, 0xCF, 0xD5, 0x28, 0xFD, 0x45, 0x16, 0xF1,
+    /* Neuron 22 */
+    0x02, 0x00, 0x01, 0x00, 0xFA, 0x9F, 0x07, 0x00, 0x80, 0x15, 0xFE, 0x7F,
+    0xF4, 0xFF,
+    /* Neuron 23 */
+    0x04, 0x06, 0x01, 0x01, 0x00, 0xFC, 0x01, 0x33, 0x05, 0x06, 0x90, 0x12,
+    0x08, 0x02, 0x80, 0x11, 0xB3, 0xF1, 0x0A, 0x98, 0x4F, 0x0C, 0x4F, 0x96,
+    0x11, 0x02, 0x80, 0x16, 0x79, 0x0B, 0x18, 0xC7, 0xD1, 0x2E, 0x94, 0x59,
+    0x97, 0xBB,
+    /* Neuron 24 */
+    0x03, 0x00, 0x01, 0x00, 0xFF, 0x9F, 0x01, 0x1B, 0x83, 0x08, 0xFD, 0x7F,
+    0x17, 0x00, 0x80, 0x7E, 0x26,
+};
+
+const edgeai_neuton_packed_q16_t edgeai_model_packed = {
+    .p_stream    = model_stream_,
+    .stream_size = sizeof(model_stream_),
+    .neurons_num = 25,
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool edgeai_model_packed_supported(const nrf_edgeai_t* p_edgeai)
+{
+    return edgeai_neuton_model_matches(p_edgeai, &model_id_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_model_packed_run_inference_q16(nrf_edgeai_t* p_edgeai)
+{
+    edgeai_neuton_run_packed_q16(&edgeai_model_packed, p_edgeai->model.params.q16.p_neurons,
+                                 (const uint16_t*)p_edgeai->p_dsp->features.extracted_memory.p_void);
+}
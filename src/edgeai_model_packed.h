@@ -0,0 +1,40 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+#ifndef EDGEAI_MODEL_PACKED_H__
+#define EDGEAI_MODEL_PACKED_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+
+#include "edgeai_neuton.h"
+
+/**
+ * Neuton q16 model graph packed into one stream of neuron records with 8-bit links interleaved
+ * with their weights, generated by scripts/neuton_codegen.py --packed from the nRF Edge AI Lab
+ * solution into edgeai_model_packed.c. Neuron values are bit-exact with the library interpreter.
+ */
+
+/** Packed graph of the model */
+extern const edgeai_neuton_packed_q16_t edgeai_model_packed;
+
+/**
+ * @brief Check that the model is the one the packed graph is generated from
+ *
+ * @param[in] p_edgeai  Pointer to the q16 model context
+ *
+ * @return true if the model solution, graph and inputs match the packed graph
+ */
+bool edgeai_model_packed_supported(const nrf_edgeai_t* p_edgeai);
+
+/**
+ * @brief Run inference of the packed graph, replaces nrf_edgeai_run_model_inference_q16() interface.
+ *        Neurons buffer of the model is written as by the library, for the outputs propagation.
+ *
+ * @param[in,out] p_edgeai  Pointer to the model context with the model inputs
+ */
+void edgeai_model_packed_run_inference_q16(nrf_edgeai_t* p_edgeai);
+
+#endif /* EDGEAI_MODEL_PACKED_H__ */
@@ -0,0 +1,354 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+/* Generated by scripts/neuton_codegen.py from src/nrf_edgeai_lib/nrf_edgeai_generated/nrf_edgeai_user_model.c, do not edit */
+
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_model_unrolled.h"
+#include "edgeai_neuton.h"
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Model the code is generated from */
+static const edgeai_neuton_model_id_t model_id_ = {
+    .p_solution_id = "84622",
+    .graph_hash    = 0x3CD69397u,
+    .neurons_num   = 25,
+    .weights_num   = 217,
+    .inputs_num    = 52,
+    .uses_as_input = 0x02,
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool edgeai_model_unrolled_supported(const nrf_edgeai_t* p_edgeai)
+{
+    return edgeai_neuton_model_matches(p_edgeai, &model_id_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_model_unrolled_run_inference_q16(nrf_edgeai_t* p_edgeai)
+{
+    const uint16_t* p_inputs = (const uint16_t*)p_edgeai->p_dsp->features.extracted_memory.p_void;
+    uint16_t* p_neurons = p_edgeai->model.params.q16.p_neurons;
+    int64_t acc;
+
+    /** Neuron 0, ReLU */
+    acc = 1893961500;
+    acc += -7401 * p_inputs[0];
+    acc += 13914 * p_inputs[1];
+    acc += 32763 * p_inputs[18];
+    acc += -6046 * p_inputs[24];
+    acc += -32650 * p_inputs[29];
+    acc += 30028 * p_inputs[30];
+    acc += 32524 * p_inputs[33];
+    acc += -3292 * p_inputs[35];
+    acc += 32766 * p_inputs[48];
+    acc += 32763 * p_inputs[49];
+    acc += 7111 * p_inputs[50];
+    const uint16_t n0 = edgeai_neuton_relu_q16(acc);
+    p_neurons[0] = n0;
+
+    /** Neuron 1, ReLU */
+    acc = -892455630;
+    acc += -8125 * p_inputs[2];
+    acc += 32764 * p_inputs[5];
+    acc += -24595 * p_inputs[6];
+    acc += 2163 * p_inputs[7];
+    acc += 7738 * p_inputs[11];
+    acc += -10988 * p_inputs[12];
+    acc += 11126 * p_inputs[15];
+    acc += -2335 * p_inputs[17];
+    acc += 1608 * p_inputs[20];
+    acc += 7764 * p_inputs[25];
+    acc += -12598 * p_inputs[32];
+    acc += 31040 * p_inputs[46];
+    acc += -19110 * p_inputs[50];
+    const uint16_t n1 = edgeai_neuton_relu_q16(acc);
+    p_neurons[1] = n1;
+
+    /** Neuron 2, ReLU */
+    acc = -1121303850;
+    acc += 16645 * n1;
+    acc += -3109 * p_inputs[0];
+    acc += -1199 * p_inputs[17];
+    acc += -26426 * p_inputs[19];
+    acc += -3921 * p_inputs[21];
+    acc += -13086 * p_inputs[33];
+    acc += 22524 * p_inputs[38];
+    acc += 26586 * p_inputs[39];
+    acc += 6409 * p_inputs[45];
+    acc += -21586 * p_inputs[47];
+    const uint16_t n2 = edgeai_neuton_relu_q16(acc);
+    p_neurons[2] = n2;
+
+    /** Neuron 3, ReLU */
+    acc = -639424995;
+    acc += 5597 * n0;
+    acc += -32742 * n1;
+    acc += 19131 * n2;
+    acc += 22626 * p_inputs[2];
+    acc += -21029 * p_inputs[4];
+    acc += 2059 * p_inputs[8];
+    acc += 20728 * p_inputs[12];
+    acc += 11375 * p_inputs[13];
+    acc += 8262 * p_inputs[15];
+    acc += 16286 * p_inputs[18];
+    acc += 12182 * p_inputs[21];
+    acc += 5790 * p_inputs[23];
+    acc += -9328 * p_inputs[27];
+    acc += 32764 * p_inputs[38];
+    acc += 22129 * p_inputs[39];
+    acc += -31923 * p_inputs[41];
+    acc += 32765 * p_inputs[45];
+    acc += 28718 * p_inputs[51];
+    const uint16_t n3 = edgeai_neuton_relu_q16(acc);
+    p_neurons[3] = n3;
+
+    /** Neuron 4, ReLU */
+    acc = -2033026770;
+    acc += -18819 * p_inputs[0];
+    acc += 20804 * p_inputs[3];
+    acc += 15370 * p_inputs[4];
+    acc += -31521 * p_inputs[6];
+    acc += -19166 * p_inputs[10];
+    acc += 30113 * p_inputs[11];
+    acc += 13603 * p_inputs[14];
+    acc += -11641 * p_inputs[17];
+    acc += 1374 * p_inputs[18];
+    acc += -22727 * p_inputs[19];
+    acc += 32767 * p_inputs[20];
+    acc += -7307 * p_inputs[22];
+    acc += -24660 * p_inputs[26];
+    acc += 2358 * p_inputs[28];
+    acc += 26347 * p_inputs[30];
+    acc += 6422 * p_inputs[37];
+    acc += -23461 * p_inputs[41];
+    acc += 25528 * p_inputs[42];
+    acc += -15937 * p_inputs[43];
+    acc += -30129 * p_inputs[44];
+    acc += 14018 * p_inputs[47];
+    const uint16_t n4 = edgeai_neuton_relu_q16(acc);
+    p_neurons[4] = n4;
+
+    /** Neuron 5, ReLU */
+    acc = 1948617690;
+    acc += 1916 * p_inputs[0];
+    acc += 32101 * p_inputs[5];
+    acc += 25315 * p_inputs[6];
+    acc += -5784 * p_inputs[7];
+    acc += -9927 * p_inputs[9];
+    acc += -23502 * p_inputs[11];
+    acc += 10306 * p_inputs[12];
+    acc += 32767 * p_inputs[19];
+    acc += -22337 * p_inputs[20];
+    acc += -10526 * p_inputs[22];
+    acc += 23779 * p_inputs[25];
+    acc += 6467 * p_inputs[26];
+    acc += -13962 * p_inputs[27];
+    acc += 2656 * p_inputs[36];
+    acc += 29231 * p_inputs[39];
+    acc += 32766 * p_inputs[48];
+    acc += 32384 * p_inputs[49];
+    const uint16_t n5 = edgeai_neuton_relu_q16(acc);
+    p_neurons[5] = n5;
+
+    /** Neuron 6, ReLU */
+    acc = -1559667465;
+    acc += -2680 * n1;
+    acc += 25143 * p_inputs[1];
+    acc += -346 * p_inputs[2];
+    acc += 15715 * p_inputs[4];
+    acc += -12290 * p_inputs[5];
+    acc += -2918 * p_inputs[8];
+    acc += 32765 * p_inputs[9];
+    acc += 32528 * p_inputs[12];
+    acc += -23776 * p_inputs[13];
+    acc += 18732 * p_inputs[16];
+    acc += 27568 * p_inputs[30];
+    acc += 28236 * p_inputs[31];
+    acc += -3564 * p_inputs[33];
+    acc += 32765 * p_inputs[42];
+    acc += 11179 * p_inputs[45];
+    const uint16_t n6 = edgeai_neuton_relu_q16(acc);
+    p_neurons[6] = n6;
+
+    /** Neuron 7, ReLU */
+    acc = 761320095;
+    acc += 11250 * n6;
+    acc += 24618 * p_inputs[6];
+    acc += 5585 * p_inputs[8];
+    acc += -6563 * p_inputs[13];
+    acc += -32659 * p_inputs[31];
+    const uint16_t n7 = edgeai_neuton_relu_q16(acc);
+    p_neurons[7] = n7;
+
+    /** Neuron 8, ReLU */
+    acc = 224653980;
+    acc += -16574 * n1;
+    acc += -32017 * n4;
+    acc += 322 * n6;
+    acc += -5892 * p_inputs[0];
+    acc += 3053 * p_inputs[2];
+    acc += 17892 * p_inputs[7];
+    acc += 8367 * p_inputs[11];
+    acc += 4631 * p_inputs[12];
+    acc += -4756 * p_inputs[17];
+    acc += 14113 * p_inputs[35];
+    const uint16_t n8 = edgeai_neuton_relu_q16(acc);
+    p_neurons[8] = n8;
+
+    /** Neuron 9, ReLU */
+    acc = -1469425770;
+    acc += 27747 * n1;
+    acc += -188 * p_inputs[0];
+    acc += 15126 * p_inputs[5];
+    acc += 11119 * p_inputs[10];
+    acc += 9037 * p_inputs[15];
+    acc += -16383 * p_inputs[40];
+    acc += -32766 * p_inputs[41];
+    const uint16_t n9 = edgeai_neuton_relu_q16(acc);
+    p_neurons[9] = n9;
+
+    /** Neuron 10, sigmoid */
+    acc = 106887585;
+    acc += -32768 * n0;
+    acc += 32766 * n9;
+    const uint16_t n10 = edgeai_neuton_sigmoid_q16(40959, acc);
+    p_neurons[10] = n10;
+
+    /** Neuron 11, ReLU */
+    acc = -638573040;
+    acc += 31724 * n2;
+    const uint16_t n11 = edgeai_neuton_relu_q16(acc);
+    p_neurons[11] = n11;
+
+    /** Neuron 12, sigmoid */
+    acc = -1056030990;
+    acc += 32765 * n2;
+    acc += 32767 * n11;
+    const uint16_t n12 = edgeai_neuton_sigmoid_q16(40959, acc);
+    p_neurons[12] = n12;
+
+    /** Neuron 13, ReLU */
+    acc = -828690075;
+    acc += 32766 * n3;
+    const uint16_t n13 = edgeai_neuton_relu_q16(acc);
+    p_neurons[13] = n13;
+
+    /** Neuron 14, sigmoid */
+    acc = 1395371220;
+    acc += -32768 * n3;
+    acc += -32768 * n13;
+    const uint16_t n14 = edgeai_neuton_sigmoid_q16(40960, acc);
+    p_neurons[14] = n14;
+
+    /** Neuron 15, ReLU */
+    acc = -142735230;
+    acc += -32766 * n4;
+    acc += 2695 * n5;
+    acc += 32766 * n9;
+    acc += 12631 * p_inputs[1];
+    acc += 9809 * p_inputs[29];
+    acc += -17148 * p_inputs[43];
+    const uint16_t n15 = edgeai_neuton_relu_q16(acc);
+    p_neurons[15] = n15;
+
+    /** Neuron 16, sigmoid */
+    acc = -568778265;
+    acc += 32765 * n4;
+    acc += -32768 * n15;
+    const uint16_t n16 = edgeai_neuton_sigmoid_q16(40955, acc);
+    p_neurons[16] = n16;
+
+    /** Neuron 17, ReLU */
+    acc = 188675265;
+    acc += -16009 * n1;
+    acc += 32553 * n5;
+    acc += 32766 * n9;
+    acc += 2993 * p_inputs[6];
+    acc += 8029 * p_inputs[10];
+    acc += 25829 * p_inputs[15];
+    acc += 16383 * p_inputs[19];
+    acc += 28732 * p_inputs[25];
+    acc += 32767 * p_inputs[44];
+    acc += -32592 * p_inputs[46];
+    acc += 32766 * p_inputs[48];
+    const uint16_t n17 = edgeai_neuton_relu_q16(acc);
+    p_neurons[17] = n17;
+
+    /** Neuron 18, sigmoid */
+    acc = 1401269370;
+    acc += -29122 * n5;
+    acc += -32768 * n17;
+    const uint16_t n18 = edgeai_neuton_sigmoid_q16(40960, acc);
+    p_neurons[18] = n18;
+
+    /** Neuron 19, ReLU */
+    acc = -1887801210;
+    acc += -28258 * n7;
+    acc += 19790 * p_inputs[5];
+    acc += 23479 * p_inputs[16];
+    acc += 13460 * p_inputs[29];
+    acc += 32465 * p_inputs[31];
+    acc += -17727 * p_inputs[33];
+    acc += 11680 * p_inputs[51];
+    const uint16_t n19 = edgeai_neuton_relu_q16(acc);
+    p_neurons[19] = n19;
+
+    /** Neuron 20, sigmoid */
+    acc = 555540195;
+    acc += -32768 * n6;
+    acc += -32768 * n19;
+    const uint16_t n20 = edgeai_neuton_sigmoid_q16(40960, acc);
+    p_neurons[20] = n20;
+
+    /** Neuron 21, ReLU */
+    acc = -250212630;
+    acc += 6479 * n2;
+    acc += -31138 * n7;
+    acc += -26818 * n8;
+    acc += 8443 * n19;
+    acc += 9583 * p_inputs[1];
+    acc += -8451 * p_inputs[7];
+    acc += -1060 * p_inputs[9];
+    acc += 325 * p_inputs[15];
+    acc += -9489 * p_inputs[21];
+    acc += 9472 * p_inputs[31];
+    acc += -10801 * p_inputs[34];
+    acc += 17917 * p_inputs[40];
+    const uint16_t n21 = edgeai_neuton_relu_q16(acc);
+    p_neurons[21] = n21;
+
+    /** Neuron 22, sigmoid */
+    acc = -786420;
+    acc += -32768 * n7;
+    acc += 32766 * n21;
+    const uint16_t n22 = edgeai_neuton_sigmoid_q16(40954, acc);
+    p_neurons[22] = n22;
+
+    /** Neuron 23, ReLU */
+    acc = -1147714455;
+    acc += 1331 * n1;
+    acc += 4752 * n6;
+    acc += -32766 * n8;
+    acc += -3661 * n17;
+    acc += 20376 * p_inputs[10];
+    acc += -27057 * p_inputs[12];
+    acc += -32766 * p_inputs[17];
+    acc += 2937 * p_inputs[22];
+    acc += -11833 * p_inputs[24];
+    acc += 22932 * p_inputs[46];
+    const uint16_t n23 = edgeai_neuton_relu_q16(acc);
+    p_neurons[23] = n23;
+
+    /** Neuron 24, sigmoid */
+    acc = 645781890;
+    acc += -31973 * n1;
+    acc += 32765 * n8;
+    acc += -32768 * n23;
+    const uint16_t n24 = edgeai_neuton_sigmoid_q16(40959, acc);
+    p_neurons[24] = n24;
+}
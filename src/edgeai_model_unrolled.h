@@ -0,0 +1,36 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+#ifndef EDGEAI_MODEL_UNROLLED_H__
+#define EDGEAI_MODEL_UNROLLED_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+
+/**
+ * Straight-line inference of the Neuton q16 model, generated by scripts/neuton_codegen.py
+ * from the nRF Edge AI Lab solution into edgeai_model_unrolled.c. Weights are immediates
+ * of the code, inputs and neurons are referenced directly and bias links are folded,
+ * so no link tables are walked. Neuron values are bit-exact with the library interpreter.
+ */
+
+/**
+ * @brief Check that the model is the one the inference is generated from
+ *
+ * @param[in] p_edgeai  Pointer to the q16 model context
+ *
+ * @return true if the model solution, graph and inputs match the generated inference
+ */
+bool edgeai_model_unrolled_supported(const nrf_edgeai_t* p_edgeai);
+
+/**
+ * @brief Run the generated model inference, replaces nrf_edgeai_run_model_inference_q16() interface.
+ *        Neurons buffer of the model is written as by the library, for the outputs propagation.
+ *
+ * @param[in,out] p_edgeai  Pointer to the model context with the model inputs
+ */
+void edgeai_model_unrolled_run_inference_q16(nrf_edgeai_t* p_edgeai);
+
+#endif /* EDGEAI_MODEL_UNROLLED_H__ */
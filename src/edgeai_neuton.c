@@ -0,0 +1,313 @@
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_neuton.h"
+
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <zephyr/sys/util.h>
+
+///
+/** Sigmoid value of the zero argument, 0.5 in Q16 */
+#define SIGMOID_Q16_HALF    (32768)
+
+/** FNV-1a 32-bit offset basis and prime */
+#define HASH_FNV_OFFSET     (2166136261u)
+#define HASH_FNV_PRIME      (16777619u)
+
+/** Input of the links beyond the model inputs */
+#define BIAS_INPUT_Q16      (65535)
+
+/** Packed neuron record header and link sizes */
+#define PACKED_HEADER_SIZE  (6)
+#define PACKED_LINK_SIZE    (3)
+#define PACKED_BIAS_SIZE    (2)
+///
+
+/** Sigmoid knots of the integer arguments, 1 / (2^k + 1) with 16 binary digits */
+static const uint16_t SIGMOID_KNOTS_[] = { 0x8000, 0x5555, 0x3333, 0x1C71, 0x0F0F, 0x07C1, 0x03F0, 0x01FC,
+                                           0x00FF, 0x007F, 0x003F, 0x001F, 0x000F, 0x0007, 0x0003, 0x0001 };
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t hash_u8_(uint32_t hash, const uint8_t* p_values, uint32_t num)
+{
+    for (uint32_t i = 0; i < num; i++)
+        hash = (hash ^ p_values[i]) * HASH_FNV_PRIME;
+
+    return hash;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t hash_u16_(uint32_t hash, const uint16_t* p_values, uint32_t num)
+{
+    for (uint32_t i = 0; i < num; i++)
+    {
+        hash = (hash ^ (p_values[i] & 0xFF)) * HASH_FNV_PRIME;
+        hash = (hash ^ (p_values[i] >> 8)) * HASH_FNV_PRIME;
+    }
+
+    return hash;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Sigmoid knot of the integer argument k, binary digits of 1 / (2^k + 1), the sigmoid of -k
+ * with the base 2 exponent, computed the library way: digit i is the parity of i / k, 16 digits.
+ * Knot of zero is 0.5.
+ */
+static uint16_t sigmoid_knot_(uint32_t k)
+{
+    if (k == 0)
+        return SIGMOID_Q16_HALF;
+
+    uint32_t digits = 0;
+
+    for (uint32_t i = 0; i < 16; i++)
+        digits |= ((i / k) & 1) << (15 - i);
+
+    return (uint16_t)digits;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint16_t sigmoid_knot_lut_(uint32_t k)
+{
+    /** Knots beyond the table have no digits within 16 bits */
+    return (k < ARRAY_SIZE(SIGMOID_KNOTS_)) ? SIGMOID_KNOTS_[k] : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint16_t sigmoid_(uint16_t weight, int64_t acc, bool is_lut)
+{
+    /** Argument is Q16, the library takes the magnitude of its low 32 bits */
+    const int64_t x = (int64_t)((uint64_t)weight * (uint64_t)acc) >> 25;
+    const int32_t x_low = (int32_t)(uint32_t)x;
+    const uint32_t magnitude = (x_low < 0) ? (0u - (uint32_t)x_low) : (uint32_t)x_low;
+    const uint32_t k = magnitude >> 16;
+    const int32_t fraction = (int32_t)(magnitude & UINT16_MAX);
+    const bool is_positive = (x >= 1);
+    const int32_t lower = is_lut ? sigmoid_knot_lut_(k) : sigmoid_knot_(k);
+
+    /** Knot of the positive argument takes the inverted digits, not 1.0 minus the knot */
+    if (fraction == 0)
+        return (is_positive && (k != 0)) ? (uint16_t)~lower : (uint16_t)lower;
+
+    /** Linear interpolation between the knots of the argument integer part */
+    const int32_t upper = is_lut ? sigmoid_knot_lut_(k + 1) : sigmoid_knot_(k + 1);
+    const uint16_t value = (uint16_t)(lower + (((upper - lower) * fraction) >> 16));
+
+    if (!is_positive)
+        return value;
+
+    return (value == 0) ? UINT16_MAX : (uint16_t)(0u - value);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t model_hash_(const nrf_edgeai_model_t* p_model)
+{
+    const nrf_edgeai_model_meta_t* p_meta = &p_model->meta;
+    const uint32_t neurons_num = p_meta->neurons_num;
+    const uint32_t weights_num = p_meta->weights_num;
+    uint32_t hash = HASH_FNV_OFFSET;
+
+    /** Every weight has its link */
+    hash = hash_u16_(hash, (const uint16_t*)p_model->params.q16.p_weights, weights_num);
+    hash = hash_u16_(hash, p_meta->p_neuron_links, weights_num);
+    hash = hash_u16_(hash, p_meta->p_neuron_internal_links_num, neurons_num);
+    hash = hash_u16_(hash, p_meta->p_neuron_external_links_num, neurons_num);
+    hash = hash_u16_(hash, p_model->params.q16.p_act_weights, neurons_num);
+    hash = hash_u8_(hash, p_meta->p_neuron_act_type_mask, (neurons_num + 7) / 8);
+
+    return hash;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t inputs_num_(const nrf_edgeai_t* p_edgeai)
+{
+    /** Library takes the raw input window when the model uses it, the extracted features otherwise */
+    if (p_edgeai->model.meta.uses_as_input.features.input)
+        return (uint32_t)p_edgeai->input.unique_num_used * p_edgeai->input.window_size;
+
+    return p_edgeai->p_dsp->features.overall_num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline bool bit_test_(const uint32_t* p_bits, uint32_t i)
+{
+    return ((p_bits[i / 32] >> (i % 32)) & 1) != 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline void bit_set_(uint32_t* p_bits, uint32_t i)
+{
+    p_bits[i / 32] |= 1u << (i % 32);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static bool neuron_links_used_(const nrf_edgeai_model_t* p_model, uint16_t n)
+{
+    const bool is_relu = ((p_model->meta.p_neuron_act_type_mask[n / 8] >> (n % 8)) & 1) != 0;
+
+    /** Sigmoid of the zero activation weight is 0.5 whatever the links sum is */
+    return is_relu || (p_model->params.q16.p_act_weights[n] != 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline int16_t packed_weight_(const uint8_t* p_value)
+{
+    return (int16_t)(uint16_t)(p_value[0] | (p_value[1] << 8));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool edgeai_neuton_model_matches(const nrf_edgeai_t* p_edgeai, const edgeai_neuton_model_id_t* p_id)
+{
+    assert((p_edgeai != NULL) && (p_id != NULL));
+
+    const nrf_edgeai_model_meta_t* p_meta = &p_edgeai->model.meta;
+
+    if ((strcmp(p_edgeai->metadata.p_solution_id, p_id->p_solution_id) != 0) ||
+        (p_meta->neurons_num != p_id->neurons_num) || (p_meta->weights_num != p_id->weights_num) ||
+        (p_meta->uses_as_input.all != p_id->uses_as_input) || (inputs_num_(p_edgeai) != p_id->inputs_num))
+        return false;
+
+    /** Solution ID is kept when the solution is trained again */
+    return model_hash_(&p_edgeai->model) == p_id->graph_hash;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint32_t edgeai_neuton_graph_size_q16(const nrf_edgeai_model_t* p_model)
+{
+    const nrf_edgeai_model_meta_t* p_meta = &p_model->meta;
+
+    return p_meta->weights_num * (sizeof(int16_t) + sizeof(uint16_t)) +
+           p_meta->neurons_num * (2 * sizeof(uint16_t) + sizeof(uint16_t)) + (p_meta->neurons_num + 7) / 8;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint16_t edgeai_neuton_consumed_inputs_q16(const nrf_edgeai_model_t* p_model,
+                                           uint16_t inputs_num,
+                                           uint32_t* p_consumed,
+                                           uint32_t* p_live)
+{
+    assert((p_model != NULL) && (p_consumed != NULL) && (p_live != NULL));
+
+    const nrf_edgeai_model_meta_t* p_meta = &p_model->meta;
+    const int16_t* p_weights = p_model->params.q16.p_weights;
+    const uint16_t neurons_num = p_meta->neurons_num;
+    uint16_t consumed_num = 0;
+    bool is_changed = true;
+
+    memset(p_live, 0, ((neurons_num + 31) / 32) * sizeof(uint32_t));
+    memset(p_consumed, 0, ((inputs_num + 31) / 32) * sizeof(uint32_t));
+
+    for (uint16_t i = 0; i < p_meta->outputs_num; i++)
+        bit_set_(p_live, p_meta->p_output_neurons_indices[i]);
+
+    /** Neurons are linked to the neurons before them mostly, so a backward sweep marks them all,
+     *  links to the neurons after take their values of the previous inference and need one more sweep */
+    while (is_changed)
+    {
+        is_changed = false;
+
+        for (uint16_t n = neurons_num; n-- > 0;)
+        {
+            if (!bit_test_(p_live, n) || !neuron_links_used_(p_model, n))
+                continue;
+
+            for (uint32_t w = (n > 0) ? p_meta->p_neuron_external_links_num[n - 1] : 0;
+                 w < p_meta->p_neuron_internal_links_num[n]; w++)
+            {
+                const uint16_t link = p_meta->p_neuron_links[w];
+
+                if ((p_weights[w] != 0) && !bit_test_(p_live, link))
+                {
+                    bit_set_(p_live, link);
+                    is_changed = true;
+                }
+            }
+        }
+    }
+
+    for (uint16_t n = 0; n < neurons_num; n++)
+    {
+        if (!bit_test_(p_live, n) || !neuron_links_used_(p_model, n))
+            continue;
+
+        /** Links beyond the model inputs take the bias input */
+        for (uint32_t w = p_meta->p_neuron_internal_links_num[n]; w < p_meta->p_neuron_external_links_num[n]; w++)
+        {
+            const uint16_t link = p_meta->p_neuron_links[w];
+
+            if ((link < inputs_num) && (p_weights[w] != 0) && !bit_test_(p_consumed, link))
+            {
+                bit_set_(p_consumed, link);
+                consumed_num++;
+            }
+        }
+    }
+
+    return consumed_num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_neuton_run_packed_q16(const edgeai_neuton_packed_q16_t* p_model,
+                                  uint16_t* p_neurons,
+                                  const uint16_t* p_inputs)
+{
+    assert((p_model != NULL) && (p_neurons != NULL) && (p_inputs != NULL));
+
+    const uint8_t* p_record = p_model->p_stream;
+
+    for (uint16_t n = 0; n < p_model->neurons_num; n++)
+    {
+        const uint8_t internal_num = p_record[0];
+        const uint8_t external_num = p_record[1];
+        const uint8_t bias_num = p_record[2];
+        const bool is_relu = (p_record[3] != 0);
+        const uint16_t act_weight = (uint16_t)packed_weight_(&p_record[4]);
+        int64_t acc = 0;
+
+        p_record += PACKED_HEADER_SIZE;
+
+        /** Links and their weights are read sequentially, in the library order */
+        for (uint8_t i = 0; i < internal_num; i++, p_record += PACKED_LINK_SIZE)
+            acc += (int32_t)packed_weight_(&p_record[1]) * p_neurons[p_record[0]];
+
+        for (uint8_t i = 0; i < external_num; i++, p_record += PACKED_LINK_SIZE)
+            acc += (int32_t)packed_weight_(&p_record[1]) * p_inputs[p_record[0]];
+
+        for (uint8_t i = 0; i < bias_num; i++, p_record += PACKED_BIAS_SIZE)
+            acc += (int32_t)packed_weight_(p_record) * BIAS_INPUT_Q16;
+
+        p_neurons[n] = is_relu ? edgeai_neuton_relu_q16(acc) : edgeai_neuton_sigmoid_q16(act_weight, acc);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint16_t edgeai_neuton_sigmoid_ref_q16(uint16_t weight, int64_t acc)
+{
+    return sigmoid_(weight, acc, false);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint16_t edgeai_neuton_sigmoid_lut_q16(uint16_t weight, int64_t acc)
+{
+    return sigmoid_(weight, acc, true);
+}
@@ -0,0 +1,172 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+#ifndef EDGEAI_NEUTON_H__
+#define EDGEAI_NEUTON_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+
+/**
+ * Neuton q16 neuron activations and inference kernels, bit-exact with the nRF Edge AI library
+ * interpreter. Neuron value is the activation of the neuron links sum, the sum of Q16 weights
+ * times Q16 inputs and neurons, links beyond the model inputs take the 65535 bias input.
+ */
+
+/**
+ * @brief Identity of the q16 model the application side model code is generated from
+ */
+typedef struct edgeai_neuton_model_id_s
+{
+    /** Edge AI Lab solution ID, kept when the solution is trained again */
+    const char* p_solution_id;
+
+    /** FNV-1a hash of the graph: weights, links, links numbers, activation weights and types,
+     *  16-bit values are taken low byte first */
+    uint32_t graph_hash;
+
+    uint16_t neurons_num;
+    uint32_t weights_num;
+
+    /** Number of model inputs, raw input window or extracted features by the uses as input mask */
+    uint16_t inputs_num;
+    uint8_t uses_as_input;
+} edgeai_neuton_model_id_t;
+
+/**
+ * @brief Packed q16 model graph, one sequential stream of neuron records with 8-bit links.
+ *
+ * Neuron record, 16-bit values little-endian:
+ *   - internal links number, external links number, bias links number, activation type (u8 each),
+ *     1 for ReLU, 0 for sigmoid,
+ *   - activation weight (u16),
+ *   - internal links, neuron index (u8) and weight (i16) each,
+ *   - external links, input index (u8) and weight (i16) each,
+ *   - bias links weights (i16).
+ *
+ * Links are taken in the library order, so the sums are the same. The encoding needs
+ * neurons_num + inputs_num < 256, other models keep the library encoding.
+ */
+typedef struct edgeai_neuton_packed_q16_s
+{
+    const uint8_t* p_stream;
+    uint32_t stream_size;
+    uint16_t neurons_num;
+} edgeai_neuton_packed_q16_t;
+
+/**
+ * @brief Check that the model is the one the application side model code is generated from
+ *
+ * @param[in] p_edgeai  Pointer to the q16 model context
+ * @param[in] p_id      Identity of the model the code is generated from
+ *
+ * @return true if the model solution, graph and inputs match
+ */
+bool edgeai_neuton_model_matches(const nrf_edgeai_t* p_edgeai, const edgeai_neuton_model_id_t* p_id);
+
+/**
+ * @brief Get size of the q16 model graph in the library encoding: weights, 16-bit links,
+ *        links numbers, activation weights and types
+ *
+ * @param[in] p_model  Model context
+ *
+ * @return Size in bytes
+ */
+uint32_t edgeai_neuton_graph_size_q16(const nrf_edgeai_model_t* p_model);
+
+/**
+ * @brief Find the model inputs the q16 model outputs depend on.
+ *
+ * Output neurons are live, and so are the neurons linked by a live neuron with a non-zero weight.
+ * An input is consumed when a live neuron links it with a non-zero weight. Sigmoid neurons with
+ * the zero activation weight do not depend on their links. Other inputs do not change the outputs,
+ * so they need not be computed.
+ *
+ * @param[in]  p_model     Model context
+ * @param[in]  inputs_num  Number of model inputs
+ * @param[out] p_consumed  Bitmap of the consumed inputs, (inputs_num + 31) / 32 words, input i is bit i % 32 of word i / 32
+ * @param[out] p_live      Bitmap of the live neurons, (neurons_num + 31) / 32 words
+ *
+ * @return Number of consumed inputs
+ */
+uint16_t edgeai_neuton_consumed_inputs_q16(const nrf_edgeai_model_t* p_model,
+                                           uint16_t inputs_num,
+                                           uint32_t* p_consumed,
+                                           uint32_t* p_live);
+
+/**
+ * @brief Run q16 inference of the packed model graph
+ *
+ * @param[in]  p_model    Packed model graph
+ * @param[out] p_neurons  Neurons buffer, neuron values as written by the library
+ * @param[in]  p_inputs   Model inputs
+ */
+void edgeai_neuton_run_packed_q16(const edgeai_neuton_packed_q16_t* p_model,
+                                  uint16_t* p_neurons,
+                                  const uint16_t* p_inputs);
+
+/**
+ * @brief Sigmoid activation of the q16 neuron, selected by the cleared activation type mask bit,
+ *        computed the library way.
+ *
+ * The activation weight scales the links sum to the Q16 argument, the sigmoid with the base 2
+ * exponent is interpolated linearly between its values at the integer arguments, the knots.
+ * Each knot is computed by 16 divisions.
+ *
+ * @param[in] weight  Activation weight of the neuron
+ * @param[in] acc     Links sum of the neuron
+ *
+ * @return Neuron value
+ */
+uint16_t edgeai_neuton_sigmoid_ref_q16(uint16_t weight, int64_t acc);
+
+/**
+ * @brief Sigmoid activation of the q16 neuron with the knots taken from a table.
+ *        The knots of the integer arguments beyond 15 are zero, so the table of 16 knots
+ *        gives the same values as @ref edgeai_neuton_sigmoid_ref_q16, the maximum error is zero.
+ *
+ * @param[in] weight  Activation weight of the neuron
+ * @param[in] acc     Links sum of the neuron
+ *
+ * @return Neuron value
+ */
+uint16_t edgeai_neuton_sigmoid_lut_q16(uint16_t weight, int64_t acc);
+
+/**
+ * @brief Sigmoid activation of the q16 neuron used by the application side model kernels
+ *
+ * @param[in] weight  Activation weight of the neuron
+ * @param[in] acc     Links sum of the neuron
+ *
+ * @return Neuron value
+ */
+static inline uint16_t edgeai_neuton_sigmoid_q16(uint16_t weight, int64_t acc)
+{
+#if CONFIG_EDGEAI_SIGMOID_LUT
+    return edgeai_neuton_sigmoid_lut_q16(weight, acc);
+#else
+    return edgeai_neuton_sigmoid_ref_q16(weight, acc);
+#endif
+}
+
+/**
+ * @brief ReLU activation of the q16 neuron, selected by the set activation type mask bit.
+ *        The activation weight is not used.
+ *
+ * @param[in] acc  Links sum of the neuron
+ *
+ * @return Neuron value
+ */
+static inline uint16_t edgeai_neuton_relu_q16(int64_t acc)
+{
+    const int64_t value = acc >> 15;
+
+    if (value < 0)
+        return 0;
+
+    return (value > UINT16_MAX) ? UINT16_MAX : (uint16_t)value;
+}
+
+#endif /* EDGEAI_NEUTON_H__ */
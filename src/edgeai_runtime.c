@@ -0,0 +1,777 @@
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_runtime.h"
+#include "edgeai_runtime_private.h"
+#include "edgeai_window.h"
+#include "edgeai_features.h"
+#include "edgeai_stats_cache.h"
+#include "edgeai_minmax.h"
+#include "edgeai_model_unrolled.h"
+#include "edgeai_model_packed.h"
+#include "edgeai_neuton.h"
+
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <nrf_edgeai/rt/private/nrf_edgeai_interfaces.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+/**
+ * Application side runtime interfaces of nRF Edge AI models.
+ * Interfaces get only the input context, one model per application is supported,
+ * its state is kept in this module.
+ */
+
+///
+/** Max number of axes with time-domain features plans */
+#define RUNTIME_PLAN_AXES_MAX       (8)
+
+/** Max number of axes with cached window statistics */
+#define RUNTIME_STATS_AXES_MAX      (6)
+
+/** Max number of statistics blocks in the window */
+#define RUNTIME_STATS_BLOCKS_MAX    (9)
+
+/** Max number of axes with tracked window min and max */
+#define RUNTIME_MINMAX_AXES_MAX     (6)
+
+/** Max window size with tracked min and max */
+#define RUNTIME_MINMAX_WINDOW_MAX   (128)
+
+/** Max number of extracted features of all axes */
+#define RUNTIME_FEATURES_MAX        (RUNTIME_PLAN_AXES_MAX * EDGEAI_FEATURES_PLAN_MAX)
+
+/** Max number of model neurons of the consumed features analysis */
+#define RUNTIME_NEURONS_MAX         (256)
+
+/** Number of windows of the batch whose features are extracted before the model runs them */
+#define RUNTIME_BATCH_WINDOWS       (16)
+///
+
+//////////////////////////////////////////////////////////////////////////////
+
+static struct
+{
+    /** Model using the ring window, NULL if the library interfaces are used */
+    nrf_edgeai_t* p_edgeai;
+
+    edgeai_window_t window;
+
+    /** Ring storage of the window, NULL to collect one window in the model window memory */
+    int16_t* p_ring;
+    uint16_t ring_frames;
+
+    /** Library window is complete and was not processed yet, hands the window over to inference */
+    atomic_t lib_window_ready;
+    /** Frames the library window needs to be completed, tracked by the feed */
+    uint16_t lib_samples_left;
+
+    /** Time-domain features plans of the axes with features, compiled from the axes masks */
+    struct
+    {
+        uint16_t axis;
+        edgeai_features_plan_t plan;
+    } plans[RUNTIME_PLAN_AXES_MAX];
+    uint16_t plans_num;
+
+    /** Number of extracted features of all axes, and of them not computed by the plans */
+    uint16_t features_num;
+    uint16_t pruned_num;
+
+#if CONFIG_EDGEAI_FEATURES_PRUNING
+    /** Extracted features consumed by the model, NULL if every feature is computed */
+    uint32_t consumed[RUNTIME_FEATURES_MAX / 32];
+    const uint32_t* p_consumed;
+#endif
+
+#if CONFIG_EDGEAI_WINDOW_STATS_CACHE
+    /** Window statistics cache, used when the window splits into few enough blocks */
+    edgeai_stats_cache_t stats_cache;
+    edgeai_block_stats_t stats_blocks[RUNTIME_STATS_AXES_MAX * RUNTIME_STATS_BLOCKS_MAX];
+    bool is_stats_cached;
+#endif
+
+#if CONFIG_EDGEAI_WINDOW_MINMAX
+    /** Window min and max trackers, used for the windows without cached statistics */
+    edgeai_minmax_t minmax[RUNTIME_MINMAX_AXES_MAX];
+    uint16_t minmax_positions[RUNTIME_MINMAX_AXES_MAX * 2 * RUNTIME_MINMAX_WINDOW_MAX];
+    bool is_minmax_tracked;
+#endif
+} runtime_;
+
+#if CONFIG_EDGEAI_BATCH_INFERENCE
+/** Q16 model inputs of the batch windows, one row of extracted features per window */
+static uint16_t batch_features_[RUNTIME_BATCH_WINDOWS * RUNTIME_FEATURES_MAX];
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+#if CONFIG_EDGEAI_RING_WINDOW
+#if CONFIG_EDGEAI_WINDOW_STATS_CACHE
+static uint16_t gcd_(uint16_t a, uint16_t b)
+{
+    while (b != 0)
+    {
+        const uint16_t rem = a % b;
+        a = b;
+        b = rem;
+    }
+
+    return a;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void stats_cache_setup_(const edgeai_window_t* p_window)
+{
+    /** Windows are made of whole blocks when both window size and shift are multiples of the block */
+    const uint16_t block_size = gcd_(p_window->size, p_window->shift);
+    const uint16_t blocks_num = p_window->size / block_size;
+
+    runtime_.is_stats_cached = (blocks_num > 1) &&
+                               (blocks_num <= RUNTIME_STATS_BLOCKS_MAX) &&
+                               (p_window->axes_num <= RUNTIME_STATS_AXES_MAX);
+
+    if (runtime_.is_stats_cached)
+    {
+        edgeai_stats_cache_init(&runtime_.stats_cache,
+                                runtime_.stats_blocks,
+                                block_size,
+                                blocks_num,
+                                p_window->axes_num);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+#endif
+
+#if CONFIG_EDGEAI_WINDOW_MINMAX
+static void minmax_setup_(const edgeai_window_t* p_window)
+{
+    runtime_.is_minmax_tracked = (p_window->size <= RUNTIME_MINMAX_WINDOW_MAX) &&
+                                 (p_window->axes_num <= RUNTIME_MINMAX_AXES_MAX);
+
+    if (runtime_.is_minmax_tracked)
+    {
+        for (uint16_t axis = 0; axis < p_window->axes_num; axis++)
+        {
+            edgeai_minmax_init(&runtime_.minmax[axis],
+                               &runtime_.minmax_positions[axis * 2 * RUNTIME_MINMAX_WINDOW_MAX],
+                               RUNTIME_MINMAX_WINDOW_MAX);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+#endif
+
+static bool ring_window_supported_(const nrf_edgeai_t* p_edgeai)
+{
+    const nrf_edgeai_input_t* p_input = &p_edgeai->input;
+    const nrf_edgeai_dsp_pipeline_t* p_dsp = p_edgeai->p_dsp;
+
+    /** Plain int16 sliding window with every axis used and no subwindows */
+    if ((p_input->type != NRF_EDGEAI_INPUT_I16) ||
+        (p_edgeai->interfaces.input_setup != nrf_edgeai_input_setup_sliding_window) ||
+        (p_edgeai->interfaces.feed_inputs != nrf_edgeai_input_feed_sliding_window_i16) ||
+        (p_input->unique_num_used != p_input->unique_num) ||
+        (p_input->unique_num > RUNTIME_PLAN_AXES_MAX) ||
+        (p_input->subwindow_num != 0))
+    {
+        return false;
+    }
+
+    /** Time-domain features only, scaled to Q16 */
+    if ((p_edgeai->interfaces.process_features != nrf_edgeai_process_features_dsp_i16_q16) ||
+        (p_dsp == NULL) ||
+        (p_dsp->features.p_timedomain_pipeline == NULL) ||
+        (p_dsp->features.masks_num < p_input->unique_num))
+    {
+        return false;
+    }
+
+    for (uint16_t axis = 0; axis < p_input->unique_num; axis++)
+    {
+        if (p_dsp->features.p_masks[axis].domain.freq.all != 0)
+            return false;
+    }
+
+    /** Every pipeline function is supported by the features plans */
+    const nrf_edgeai_features_pipeline_ctx_t* p_pipeline = p_dsp->features.p_timedomain_pipeline;
+    for (size32_t i = 0; i < p_pipeline->functions_num; i++)
+    {
+        if (!edgeai_features_supported(p_pipeline->functions.p_array_i16[i]))
+            return false;
+    }
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+#if CONFIG_EDGEAI_FEATURES_PRUNING
+static const uint32_t* features_consumed_(const nrf_edgeai_t* p_edgeai)
+{
+    const nrf_edgeai_model_meta_t* p_meta = &p_edgeai->model.meta;
+    const uint16_t features_num = (uint16_t)p_edgeai->p_dsp->features.overall_num;
+    uint32_t live[RUNTIME_NEURONS_MAX / 32];
+
+    /** Links of the q16 model index the extracted features when they are its only inputs */
+    if ((p_edgeai->interfaces.run_inference != nrf_edgeai_run_model_inference_q16) ||
+        p_meta->uses_as_input.features.input ||
+        !p_meta->uses_as_input.features.extracted ||
+        (features_num > RUNTIME_FEATURES_MAX) ||
+        (p_meta->neurons_num > RUNTIME_NEURONS_MAX))
+    {
+        return NULL;
+    }
+
+    edgeai_neuton_consumed_inputs_q16(&p_edgeai->model, features_num, runtime_.consumed, live);
+
+    return runtime_.consumed;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+#endif
+
+static bool plans_compile_(const nrf_edgeai_t* p_edgeai, const uint32_t* p_consumed)
+{
+    const nrf_edgeai_dsp_feature_extraction_t* p_features = &p_edgeai->p_dsp->features;
+    const nrf_edgeai_features_pipeline_ctx_t* p_pipeline = p_features->p_timedomain_pipeline;
+
+    runtime_.plans_num = 0;
+    runtime_.features_num = 0;
+    runtime_.pruned_num = 0;
+
+    for (uint16_t axis = 0; axis < p_edgeai->input.unique_num; axis++)
+    {
+        edgeai_features_plan_t* p_plan = &runtime_.plans[runtime_.plans_num].plan;
+
+        if (!edgeai_features_plan_compile(p_plan,
+                                          p_pipeline->functions.p_array_i16,
+                                          (uint16_t)p_pipeline->functions_num,
+                                          p_features->p_masks[axis].domain.time,
+                                          p_consumed,
+                                          runtime_.features_num))
+        {
+            return false;
+        }
+
+        runtime_.features_num += p_plan->features_num;
+        runtime_.pruned_num += p_plan->features_num - p_plan->emits_num;
+
+        /** Axes without computed features are not visited by the extraction */
+        if (p_plan->emits_num > 0)
+        {
+            runtime_.plans[runtime_.plans_num].axis = axis;
+            runtime_.plans_num++;
+        }
+    }
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static nrf_edgeai_err_t input_setup_ring_window_(nrf_edgeai_input_t* p_input)
+{
+    assert(p_input == &runtime_.p_edgeai->input);
+
+    int16_t* p_buffer = p_input->window_memory.p_i16;
+    uint16_t capacity = p_input->window_size;
+
+    /** Ring longer than the window collects several windows for the bulk feed */
+    if ((runtime_.p_ring != NULL) && (runtime_.ring_frames > p_input->window_size))
+    {
+        p_buffer = runtime_.p_ring;
+        capacity = runtime_.ring_frames;
+    }
+
+    edgeai_window_init(&runtime_.window,
+                       p_buffer,
+                       capacity,
+                       p_input->window_size,
+                       p_input->window_shift,
+                       p_input->unique_num);
+
+#if CONFIG_EDGEAI_WINDOW_STATS_CACHE
+    stats_cache_setup_(&runtime_.window);
+#endif
+#if CONFIG_EDGEAI_WINDOW_MINMAX
+    minmax_setup_(&runtime_.window);
+#endif
+
+    return NRF_EDGEAI_ERR_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static nrf_edgeai_err_t input_feed_ring_window_(nrf_edgeai_input_t* p_input,
+                                                void* p_input_values,
+                                                uint16_t num_values)
+{
+    if ((uintptr_t)p_input_values & 1)
+        return NRF_EDGEAI_ERR_WRONG_MEM_ALIGNMENT;
+
+    uint16_t samples_left = edgeai_window_feed(&runtime_.window,
+                                               p_input_values,
+                                               num_values / p_input->unique_num);
+
+    return (samples_left == 0) ? NRF_EDGEAI_ERR_SUCCESS : NRF_EDGEAI_ERR_INPROGRESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static nrf_edgeai_err_t process_features_ring_window_(nrf_edgeai_input_t* p_input,
+                                                      nrf_edgeai_dsp_pipeline_t* p_dsp)
+{
+    ARG_UNUSED(p_input);
+
+    int32_t* p_extracted = p_dsp->features.extracted_memory.p_i32;
+
+    /** Features are extracted from the oldest complete window */
+    if (edgeai_window_ready(&runtime_.window) == 0)
+        return NRF_EDGEAI_ERR_INPROGRESS;
+
+    for (uint16_t i = 0; i < runtime_.plans_num; i++)
+    {
+        const uint16_t axis = runtime_.plans[i].axis;
+        const edgeai_features_plan_t* p_plan = &runtime_.plans[i].plan;
+        const edgeai_stat_ctx_t* p_moments = NULL;
+        const edgeai_pairwise_t* p_pairwise = NULL;
+        edgeai_span_t span;
+        edgeai_window_span(&runtime_.window, axis, &span);
+
+#if CONFIG_EDGEAI_WINDOW_STATS_CACHE
+        /** Only the blocks added by the window shift are scanned for the window moments and crossings */
+        edgeai_stat_ctx_t moments;
+        edgeai_pairwise_t pairwise;
+        if (runtime_.is_stats_cached &&
+            (p_plan->is_sums_needed || p_plan->is_extrema_needed || p_plan->is_pairwise_needed))
+        {
+            edgeai_stats_cache_window(&runtime_.stats_cache,
+                                      axis,
+                                      &span,
+                                      edgeai_window_start(&runtime_.window),
+                                      &moments,
+                                      &pairwise);
+            p_moments = &moments;
+            p_pairwise = &pairwise;
+        }
+#endif
+
+        const edgeai_extrema_t* p_extrema = NULL;
+#if CONFIG_EDGEAI_WINDOW_MINMAX
+        /** Without cached moments, only the samples added since the previous window are taken into the deques */
+        edgeai_extrema_t extrema;
+        if ((p_moments == NULL) && runtime_.is_minmax_tracked && p_plan->is_extrema_needed)
+        {
+            edgeai_minmax_window(&runtime_.minmax[axis],
+                                 &span,
+                                 edgeai_window_start(&runtime_.window),
+                                 &extrema);
+            p_extrema = &extrema;
+        }
+#endif
+
+        edgeai_features_extract(p_plan, &span, p_moments, p_extrema, p_pairwise, p_extracted);
+    }
+
+    edgeai_features_scale_q16(p_extracted,
+                              runtime_.features_num,
+                              p_dsp->features.meta.i32.p_min,
+                              p_dsp->features.meta.i32.p_max);
+
+    return NRF_EDGEAI_ERR_SUCCESS;
+}
+#endif // CONFIG_EDGEAI_RING_WINDOW
+
+#if CONFIG_EDGEAI_FIXED_POINT_OUTPUT
+//////////////////////////////////////////////////////////////////////////////
+
+static void decode_classification_q16_(nrf_edgeai_model_output_t* p_model_output,
+                                       nrf_edgeai_decoded_output_t* p_decoded_output)
+{
+    uint16_t* p_probabilities = p_model_output->memory.p_q16;
+    uint16_t predicted_class = 0;
+    uint16_t max = 0;
+    uint32_t sum = 0;
+
+    /** First of the max outputs is predicted, as by the library decoding */
+    for (uint16_t i = 0; i < p_model_output->num; i++)
+    {
+        sum += p_probabilities[i];
+        if (p_probabilities[i] > max)
+        {
+            max = p_probabilities[i];
+            predicted_class = i;
+        }
+    }
+
+    /** Outputs are normalized to the probabilities summing to one, as the library float decoding does,
+     *  UINT16_MAX is 1.0 so that a single output keeps the whole probability. Rounded to nearest,
+     *  the remainder is compared instead of adding half of the sum, which would overflow 32 bits */
+    for (uint16_t i = 0; i < p_model_output->num; i++)
+    {
+        const uint32_t scaled = (uint32_t)p_probabilities[i] * UINT16_MAX;
+        p_probabilities[i] = (sum > 0) ? (uint16_t)((scaled / sum) + (((scaled % sum) * 2) >= sum)) : 0;
+    }
+
+    p_decoded_output->classif.predicted_class = predicted_class;
+    p_decoded_output->classif.num_classes = p_model_output->num;
+    p_decoded_output->classif.probabilities.p_q16 = p_probabilities;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+nrf_edgeai_err_t edgeai_runtime_init(nrf_edgeai_t* p_edgeai, int16_t* p_ring, uint16_t ring_frames)
+{
+    assert(p_edgeai != NULL);
+
+    runtime_.p_edgeai = NULL;
+    runtime_.p_ring = p_ring;
+    runtime_.ring_frames = ring_frames;
+    atomic_set(&runtime_.lib_window_ready, 0);
+
+#if CONFIG_EDGEAI_RING_WINDOW
+    if (ring_window_supported_(p_edgeai))
+    {
+        const uint32_t* p_consumed = NULL;
+#if CONFIG_EDGEAI_FEATURES_PRUNING
+        /** Features the model outputs do not depend on are not extracted */
+        p_consumed = features_consumed_(p_edgeai);
+        runtime_.p_consumed = p_consumed;
+#endif
+
+        if (plans_compile_(p_edgeai, p_consumed))
+        {
+            runtime_.p_edgeai = p_edgeai;
+
+            p_edgeai->interfaces.input_setup = input_setup_ring_window_;
+            p_edgeai->interfaces.feed_inputs = input_feed_ring_window_;
+            p_edgeai->interfaces.process_features = process_features_ring_window_;
+        }
+    }
+#endif
+
+#if CONFIG_EDGEAI_FIXED_POINT_OUTPUT
+    /** Q16 classification outputs are kept in Q16 instead of the float conversion */
+    if ((p_edgeai->interfaces.propagate_outputs == nrf_edgeai_output_dequantize_q16_f32) &&
+        (p_edgeai->interfaces.decode_outputs == nrf_edgeai_output_decode_classification_f32))
+    {
+        p_edgeai->interfaces.propagate_outputs = nrf_edgeai_output_propagate_q16;
+        p_edgeai->interfaces.decode_outputs = decode_classification_q16_;
+    }
+#endif
+
+    /** Model the application side code is generated from runs it instead of the library interpreter */
+    const bool is_library_q16 = (p_edgeai->interfaces.run_inference == nrf_edgeai_run_model_inference_q16);
+#if CONFIG_EDGEAI_UNROLLED_INFERENCE
+    if (is_library_q16 && edgeai_model_unrolled_supported(p_edgeai))
+        p_edgeai->interfaces.run_inference = edgeai_model_unrolled_run_inference_q16;
+#elif CONFIG_EDGEAI_PACKED_INFERENCE
+    if (is_library_q16 && edgeai_model_packed_supported(p_edgeai))
+        p_edgeai->interfaces.run_inference = edgeai_model_packed_run_inference_q16;
+#else
+    (void)is_library_q16;
+#endif
+
+    nrf_edgeai_err_t res = nrf_edgeai_init(p_edgeai);
+    runtime_.lib_samples_left = nrf_edgeai_input_window_size(p_edgeai);
+
+    return res;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+nrf_edgeai_err_t edgeai_runtime_set_window_shift(nrf_edgeai_t* p_edgeai, uint16_t shift)
+{
+    assert(p_edgeai != NULL);
+
+    /** Library window shift is fixed by the generated model */
+    if (p_edgeai != runtime_.p_edgeai)
+        return NRF_EDGEAI_ERR_NOT_SUPPORTED;
+
+    if ((shift == 0) || (shift > p_edgeai->input.window_size))
+        return NRF_EDGEAI_ERR_INVALID_ARGUMENT;
+
+    edgeai_window_set_shift(&runtime_.window, shift);
+
+#if CONFIG_EDGEAI_WINDOW_STATS_CACHE
+    /** Blocks follow the new shift, they are computed again for the next window */
+    stats_cache_setup_(&runtime_.window);
+#endif
+
+    return NRF_EDGEAI_ERR_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint16_t edgeai_runtime_samples_left(const nrf_edgeai_t* p_edgeai)
+{
+    if (p_edgeai == runtime_.p_edgeai)
+        return edgeai_window_samples_left(&runtime_.window);
+
+    return runtime_.lib_samples_left;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint16_t edgeai_runtime_feed(nrf_edgeai_t* p_edgeai,
+                             const int16_t* p_frames,
+                             uint16_t frames_num,
+                             uint16_t* p_fed_num)
+{
+    assert(p_fed_num != NULL);
+
+    if (p_edgeai == runtime_.p_edgeai)
+    {
+        *p_fed_num = edgeai_window_push(&runtime_.window, p_frames, frames_num);
+        return edgeai_window_ready(&runtime_.window);
+    }
+
+    /** Library window holds one window, frames are not taken until it is processed, the inference reads
+     *  the window in the library memory, so the feed does not overlap it on this path */
+    const uint16_t axes_num = p_edgeai->input.unique_num;
+    *p_fed_num = 0;
+
+    while (!atomic_get(&runtime_.lib_window_ready) && (*p_fed_num < frames_num))
+    {
+        uint16_t chunk_frames = MIN(frames_num - *p_fed_num, edgeai_runtime_samples_left(p_edgeai));
+
+        nrf_edgeai_err_t res = nrf_edgeai_feed_inputs(p_edgeai,
+                                                      (int16_t*)&p_frames[*p_fed_num * axes_num],
+                                                      chunk_frames * axes_num);
+        *p_fed_num += chunk_frames;
+        runtime_.lib_samples_left -= chunk_frames;
+
+        if (res == NRF_EDGEAI_ERR_SUCCESS)
+        {
+            /** Completed window is shifted on the next feed */
+            runtime_.lib_samples_left = p_edgeai->input.window_shift;
+            atomic_set(&runtime_.lib_window_ready, 1);
+        }
+    }
+
+    return atomic_get(&runtime_.lib_window_ready) ? 1 : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint16_t edgeai_runtime_run_windows(nrf_edgeai_t* p_edgeai, edgeai_runtime_output_cb_t output_cb)
+{
+    assert(output_cb != NULL);
+
+    uint16_t windows_num = 0;
+
+    if (p_edgeai == runtime_.p_edgeai)
+    {
+        while (edgeai_window_ready(&runtime_.window) > 0)
+        {
+            /** Inference reads the oldest window, it is slid right after */
+            nrf_edgeai_err_t res = nrf_edgeai_run_inference(p_edgeai);
+            edgeai_window_slide(&runtime_.window);
+            windows_num++;
+
+            if (res == NRF_EDGEAI_ERR_SUCCESS)
+                output_cb(p_edgeai);
+        }
+    }
+    else if (atomic_get(&runtime_.lib_window_ready))
+    {
+        /** Window is returned to the feed once the inference is done with it */
+        nrf_edgeai_err_t res = nrf_edgeai_run_inference(p_edgeai);
+        atomic_clear(&runtime_.lib_window_ready);
+        windows_num++;
+
+        if (res == NRF_EDGEAI_ERR_SUCCESS)
+            output_cb(p_edgeai);
+    }
+
+    return windows_num;
+}
+
+#if CONFIG_EDGEAI_FEATURES_BENCHMARK || CONFIG_EDGEAI_BATCH_INFERENCE
+//////////////////////////////////////////////////////////////////////////////
+
+static void window_reset_(edgeai_window_t* p_window)
+{
+    edgeai_window_init(p_window,
+                       p_window->p_buffer,
+                       p_window->capacity,
+                       p_window->size,
+                       p_window->shift,
+                       p_window->axes_num);
+
+#if CONFIG_EDGEAI_WINDOW_STATS_CACHE
+    stats_cache_setup_(p_window);
+#endif
+#if CONFIG_EDGEAI_WINDOW_MINMAX
+    minmax_setup_(p_window);
+#endif
+}
+#endif
+
+#if CONFIG_EDGEAI_FEATURES_BENCHMARK
+//////////////////////////////////////////////////////////////////////////////
+
+edgeai_window_t* edgeai_runtime_window(const nrf_edgeai_t* p_edgeai)
+{
+    return (p_edgeai == runtime_.p_edgeai) ? &runtime_.window : NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_runtime_window_reset(bool is_cached)
+{
+    window_reset_(&runtime_.window);
+
+    /** Without the caches every extraction computes the window statistics from the samples */
+#if CONFIG_EDGEAI_WINDOW_STATS_CACHE
+    runtime_.is_stats_cached = runtime_.is_stats_cached && is_cached;
+#endif
+#if CONFIG_EDGEAI_WINDOW_MINMAX
+    runtime_.is_minmax_tracked = runtime_.is_minmax_tracked && is_cached;
+#endif
+    (void)is_cached;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_runtime_features_info(edgeai_runtime_features_info_t* p_info)
+{
+    assert(p_info != NULL);
+
+    p_info->features_num = runtime_.features_num;
+    p_info->pruned_num = runtime_.pruned_num;
+    p_info->p_consumed = NULL;
+#if CONFIG_EDGEAI_FEATURES_PRUNING
+    p_info->p_consumed = runtime_.p_consumed;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool edgeai_runtime_plans_compile(const nrf_edgeai_t* p_edgeai, bool is_pruned)
+{
+    assert(p_edgeai == runtime_.p_edgeai);
+
+    const uint32_t* p_consumed = NULL;
+#if CONFIG_EDGEAI_FEATURES_PRUNING
+    p_consumed = is_pruned ? runtime_.p_consumed : NULL;
+#endif
+    (void)is_pruned;
+
+    return plans_compile_(p_edgeai, p_consumed);
+}
+#endif // CONFIG_EDGEAI_FEATURES_BENCHMARK
+
+
+#if CONFIG_EDGEAI_BATCH_INFERENCE
+//////////////////////////////////////////////////////////////////////////////
+
+static uint16_t batch_probability_(const nrf_edgeai_t* p_edgeai)
+{
+    const nrf_edgeai_decoded_output_classif_t* p_classif = &p_edgeai->decoded_output.classif;
+
+#if CONFIG_EDGEAI_FIXED_POINT_OUTPUT
+    if (p_edgeai->interfaces.decode_outputs == decode_classification_q16_)
+        return p_classif->probabilities.p_q16[p_classif->predicted_class];
+#endif
+
+    const flt32_t probability = p_classif->probabilities.p_f32[p_classif->predicted_class];
+
+    return (uint16_t)(CLAMP(probability, 0.0f, 1.0f) * UINT16_MAX);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static nrf_edgeai_err_t batch_inference_(nrf_edgeai_t* p_edgeai)
+{
+    p_edgeai->interfaces.run_inference(p_edgeai);
+    p_edgeai->interfaces.propagate_outputs(&p_edgeai->model);
+    p_edgeai->interfaces.decode_outputs(&p_edgeai->model.output, &p_edgeai->decoded_output);
+
+    /** The inference interfaces return no status, a run is checked by its decoded class,
+     *  which also indexes the probability of the output */
+    const nrf_edgeai_decoded_output_classif_t* p_classif = &p_edgeai->decoded_output.classif;
+    if (p_classif->predicted_class >= p_classif->num_classes)
+        return NRF_EDGEAI_ERR_UNSPECIFIED_ERROR;
+
+    return NRF_EDGEAI_ERR_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+nrf_edgeai_err_t edgeai_runtime_run_batch(nrf_edgeai_t* p_edgeai,
+                                          const int16_t* p_windows,
+                                          uint32_t windows_num,
+                                          edgeai_runtime_classification_t* p_outputs)
+{
+    assert((p_edgeai != NULL) && (((p_windows != NULL) && (p_outputs != NULL)) || (windows_num == 0)));
+
+    if (p_edgeai != runtime_.p_edgeai)
+        return NRF_EDGEAI_ERR_NOT_SUPPORTED;
+
+    nrf_edgeai_input_t* p_input = &p_edgeai->input;
+    nrf_edgeai_dsp_pipeline_t* p_dsp = p_edgeai->p_dsp;
+    const nrf_edgeai_model_meta_t* p_meta = &p_edgeai->model.meta;
+    uint16_t* p_features = (uint16_t*)p_dsp->features.extracted_memory.p_void;
+    const uint16_t features_num = (uint16_t)p_dsp->features.overall_num;
+    const size_t window_values = (size_t)p_input->window_size * p_input->unique_num;
+
+    /** Classification models taking the extracted features only, those are all the model reads of a window */
+    if (p_meta->uses_as_input.features.input ||
+        ((p_meta->task != NRF_EDGEAI_TASK_MULT_CLASS) && (p_meta->task != NRF_EDGEAI_TASK_BIN_CLASS)) ||
+        (features_num > RUNTIME_FEATURES_MAX))
+    {
+        return NRF_EDGEAI_ERR_NOT_SUPPORTED;
+    }
+
+    for (uint32_t first = 0; first < windows_num; first += RUNTIME_BATCH_WINDOWS)
+    {
+        const uint16_t block_num = (uint16_t)MIN(windows_num - first, RUNTIME_BATCH_WINDOWS);
+
+        /** Features of the block windows are extracted first, each window from its own frames */
+        for (uint16_t i = 0; i < block_num; i++)
+        {
+            window_reset_(&runtime_.window);
+            edgeai_window_push(&runtime_.window, &p_windows[(first + i) * window_values], p_input->window_size);
+
+            nrf_edgeai_err_t res = p_edgeai->interfaces.process_features(p_input, p_dsp);
+            if (res != NRF_EDGEAI_ERR_SUCCESS)
+            {
+                window_reset_(&runtime_.window);
+                return res;
+            }
+
+            memcpy(&batch_features_[i * features_num], p_features, features_num * sizeof(uint16_t));
+        }
+
+        /** Then the model runs them back-to-back in the window order, as the library inference steps,
+         *  so its weights and neurons stay in the cache over the block */
+        for (uint16_t i = 0; i < block_num; i++)
+        {
+            memcpy(p_features, &batch_features_[i * features_num], features_num * sizeof(uint16_t));
+
+            nrf_edgeai_err_t res = batch_inference_(p_edgeai);
+            if (res != NRF_EDGEAI_ERR_SUCCESS)
+            {
+                window_reset_(&runtime_.window);
+                return res;
+            }
+
+            p_outputs[first + i].predicted_class = p_edgeai->decoded_output.classif.predicted_class;
+            p_outputs[first + i].probability = batch_probability_(p_edgeai);
+        }
+    }
+
+    /** Batch windows are dropped */
+    window_reset_(&runtime_.window);
+
+    return NRF_EDGEAI_ERR_SUCCESS;
+}
+#endif // CONFIG_EDGEAI_BATCH_INFERENCE
@@ -0,0 +1,142 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+#ifndef EDGEAI_RUNTIME_H__
+#define EDGEAI_RUNTIME_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+
+/**
+ * @brief Model output handler called for every window processed by @ref edgeai_runtime_run_windows
+ *
+ * @param[in] p_edgeai  Pointer to the model context with the decoded output of the window
+ */
+typedef void (*edgeai_runtime_output_cb_t)(nrf_edgeai_t* p_edgeai);
+
+/**
+ * @brief Decoded classification of one window of @ref edgeai_runtime_run_batch
+ */
+typedef struct edgeai_runtime_classification_s
+{
+    uint16_t predicted_class;
+
+    /** Probability of the predicted class, UINT16_MAX is 1.0 */
+    uint16_t probability;
+} edgeai_runtime_classification_t;
+
+/**
+ * @brief Initialize nRF Edge AI runtime of the model.
+ *
+ * When enabled and supported by the model configuration, the library sliding window
+ * and feature extraction interfaces are replaced by the ring window, which is slid
+ * without moving the window data, and features are extracted from the ring in place.
+ * Per-axis features plans are compiled from the model features masks, so the extraction
+ * computes only the features of each axis. With CONFIG_EDGEAI_FEATURES_PRUNING, the features
+ * the q16 model outputs do not depend on, found from the model links, are not computed either.
+ * Other models are initialized with the library interfaces.
+ * With CONFIG_EDGEAI_FIXED_POINT_OUTPUT, class probabilities of q16 classification models
+ * are decoded in Q16, probabilities.p_q16 of the decoded output, instead of p_f32.
+ * The model the application side model code is generated from runs the inference kernel
+ * selected by the configuration, the straight-line or the packed graph inference.
+ *
+ * @param[in] p_edgeai     Pointer to the generated model context
+ * @param[in] p_ring       Ring window storage, ring_frames * model inputs values,
+ *                         NULL to collect one window in the model window memory
+ * @param[in] ring_frames  Ring window capacity in frames, windows beyond the first one
+ *                         take window shift frames each
+ *
+ * @return nRF Edge AI library initialization status
+ */
+nrf_edgeai_err_t edgeai_runtime_init(nrf_edgeai_t* p_edgeai, int16_t* p_ring, uint16_t ring_frames);
+
+/**
+ * @brief Change the model window shift at runtime, without regenerating the model.
+ *
+ * Smaller shift runs inference more often, so a gesture is classified sooner at the cost
+ * of more inference per second. The window size is kept. Only models using the ring window
+ * support it, call it on the inference side, from the same thread as @ref edgeai_runtime_run_windows.
+ *
+ * @param[in] p_edgeai  Pointer to the model context
+ * @param[in] shift     Window shift in frames, from 1 to the window size
+ *
+ * @return NRF_EDGEAI_ERR_SUCCESS, NRF_EDGEAI_ERR_INVALID_ARGUMENT for the shift out of range,
+ *         NRF_EDGEAI_ERR_NOT_SUPPORTED for the library window
+ */
+nrf_edgeai_err_t edgeai_runtime_set_window_shift(nrf_edgeai_t* p_edgeai, uint16_t shift);
+
+/**
+ * @brief Get number of input frames the model window needs to be completed on the next feed.
+ *        Frames fed beyond the completed window are ignored.
+ *
+ * @param[in] p_edgeai  Pointer to the model context
+ *
+ * @return Number of frames, window shift if the window is complete now
+ */
+uint16_t edgeai_runtime_samples_left(const nrf_edgeai_t* p_edgeai);
+
+/**
+ * @brief Feed a block of interleaved input frames of any length.
+ *
+ * Frames are taken until the window storage is full of complete windows, the rest
+ * of the block is fed after the ready windows are processed by @ref edgeai_runtime_run_windows.
+ * Complete windows are handed over to @ref edgeai_runtime_run_windows as they are and are not
+ * written until processed, so the feed and the inference may run on two different threads.
+ * Only the ring window overlaps them: it keeps collecting the next windows while the inference
+ * reads the complete one. The library window holds one window, the inference reads it from the
+ * library window memory, so with the library window no frames are taken from a complete window
+ * until it is processed, and the acquisition waits for the inference.
+ * Must not be mixed with nrf_edgeai_feed_inputs() on the same model.
+ *
+ * @param[in]  p_edgeai    Pointer to the model context
+ * @param[in]  p_frames    Interleaved input frames, model inputs values each
+ * @param[in]  frames_num  Number of input frames
+ * @param[out] p_fed_num   Number of frames taken from the block
+ *
+ * @return Number of complete windows ready for inference
+ */
+uint16_t edgeai_runtime_feed(nrf_edgeai_t* p_edgeai,
+                             const int16_t* p_frames,
+                             uint16_t frames_num,
+                             uint16_t* p_fed_num);
+
+/**
+ * @brief Run inference of every ready window back-to-back, oldest first,
+ *        and slide the window past each of them.
+ *        May run on another thread than @ref edgeai_runtime_feed, concurrently with it.
+ *
+ * @param[in] p_edgeai   Pointer to the model context
+ * @param[in] output_cb  Handler of each successful inference output
+ *
+ * @return Number of processed windows
+ */
+uint16_t edgeai_runtime_run_windows(nrf_edgeai_t* p_edgeai, edgeai_runtime_output_cb_t output_cb);
+
+#if CONFIG_EDGEAI_BATCH_INFERENCE
+/**
+ * @brief Classify a batch of independent windows, e.g. windows of a recorded dataset.
+ *
+ * Windows are taken in blocks: features of all windows of the block are extracted first,
+ * then the model runs them back-to-back, so the model weights stay in the cache over the block
+ * instead of alternating with the extraction for every window. The inference steps are the ones
+ * of nrf_edgeai_run_inference(), in the window order. Call instead of the feed, not concurrently with it,
+ * the collected window is dropped.
+ *
+ * @param[in]  p_edgeai     Pointer to the classification model context
+ * @param[in]  p_windows    Windows one after another, window size interleaved input frames each
+ * @param[in]  windows_num  Number of windows
+ * @param[out] p_outputs    Decoded classification of every window
+ *
+ * @return NRF_EDGEAI_ERR_SUCCESS, NRF_EDGEAI_ERR_NOT_SUPPORTED for the library window or the model
+ *         not classifying the extracted features, features extraction error,
+ *         NRF_EDGEAI_ERR_UNSPECIFIED_ERROR for an inference not decoded to a model class
+ */
+nrf_edgeai_err_t edgeai_runtime_run_batch(nrf_edgeai_t* p_edgeai,
+                                          const int16_t* p_windows,
+                                          uint32_t windows_num,
+                                          edgeai_runtime_classification_t* p_outputs);
+#endif
+
+#endif /* EDGEAI_RUNTIME_H__ */
@@ -0,0 +1,67 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+#ifndef EDGEAI_RUNTIME_PRIVATE_H__
+#define EDGEAI_RUNTIME_PRIVATE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+
+#include "edgeai_window.h"
+
+/**
+ * Runtime internals used by the startup benchmarks, not an application interface.
+ */
+
+/**
+ * @brief Extracted features of the model plans
+ */
+typedef struct edgeai_runtime_features_info_s
+{
+    /** Number of extracted features, and of them not computed since the model does not consume them */
+    uint16_t features_num;
+    uint16_t pruned_num;
+
+    /** Extracted features consumed by the model, NULL if every feature is computed */
+    const uint32_t* p_consumed;
+} edgeai_runtime_features_info_t;
+
+#if CONFIG_EDGEAI_FEATURES_BENCHMARK
+/**
+ * @brief Get the ring window of the model
+ *
+ * @param[in] p_edgeai  Pointer to the model context
+ *
+ * @return Pointer to the ring window, NULL if the model uses the library window
+ */
+edgeai_window_t* edgeai_runtime_window(const nrf_edgeai_t* p_edgeai);
+
+/**
+ * @brief Drop the ring window samples
+ *
+ * @param[in] is_cached  Window statistics cache and min/max trackers are used until the next reset,
+ *                       otherwise the features are extracted from the window samples
+ */
+void edgeai_runtime_window_reset(bool is_cached);
+
+/**
+ * @brief Get the extracted features of the model plans
+ *
+ * @param[out] p_info  Features of the plans
+ */
+void edgeai_runtime_features_info(edgeai_runtime_features_info_t* p_info);
+
+/**
+ * @brief Compile the plans of the ring window model again
+ *
+ * @param[in] p_edgeai   Pointer to the model context
+ * @param[in] is_pruned  Features the model does not consume are left out of the plans
+ *
+ * @return true if the plans are compiled
+ */
+bool edgeai_runtime_plans_compile(const nrf_edgeai_t* p_edgeai, bool is_pruned);
+#endif
+
+#endif /* EDGEAI_RUNTIME_PRIVATE_H__ */
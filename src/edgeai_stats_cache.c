@@ -0,0 +1,152 @@
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_stats_cache.h"
+
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <assert.h>
+#include <stddef.h>
+
+#include <zephyr/sys/util.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline void add_pair_(edgeai_pairwise_t* p_pairwise, int16_t prev, int16_t value)
+{
+    /** Sign is bit 15, difference is squared after wrapping to int16, as in the library */
+    const int32_t diff = prev - value;
+    const int16_t wrapped_diff = (int16_t)(uint16_t)((uint16_t)prev - (uint16_t)value);
+
+    if (((uint16_t)prev >> 15) != ((uint16_t)value >> 15))
+        p_pairwise->zero_crossings++;
+    p_pairwise->diff_abssum += (uint32_t)((diff < 0) ? -diff : diff);
+    p_pairwise->diff_square_sum += (uint32_t)((int32_t)wrapped_diff * wrapped_diff);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void block_stats_(const edgeai_span_t* p_span, uint32_t start, edgeai_block_stats_t* p_block)
+{
+    uint32_t sum = 0;
+    uint32_t abssum = 0;
+    uint64_t tss = 0;
+    uint16_t positive_num = 0;
+    int16_t min = INT16_MAX;
+    int16_t max = INT16_MIN;
+    edgeai_pairwise_t pairwise = { 0 };
+    int16_t prev = p_span->p_seg[0][0];
+
+    /** Accumulated with the same wrap around as the library features, the first sample is paired with itself */
+    for (uint8_t seg = 0; seg < 2; seg++)
+    {
+        const int16_t* p_data = p_span->p_seg[seg];
+
+        for (uint16_t i = 0; i < p_span->num[seg]; i++)
+        {
+            const int16_t value = p_data[i];
+
+            sum += (uint32_t)value;
+            abssum += (uint16_t)((value < 0) ? -value : value);
+            tss += (uint64_t)((int32_t)value * value);
+            positive_num += (value > 0) ? 1 : 0;
+            min = MIN(min, value);
+            max = MAX(max, value);
+            add_pair_(&pairwise, prev, value);
+            prev = value;
+        }
+    }
+
+    p_block->sum = (int32_t)sum;
+    p_block->abssum = abssum;
+    p_block->tss = tss;
+    p_block->start = start;
+    p_block->positive_num = positive_num;
+    p_block->min = min;
+    p_block->max = max;
+    p_block->first = p_span->p_seg[0][0];
+    p_block->last = prev;
+    p_block->pairwise = pairwise;
+    p_block->is_valid = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_stats_cache_init(edgeai_stats_cache_t* p_cache,
+                             edgeai_block_stats_t* p_blocks,
+                             uint16_t block_size,
+                             uint16_t blocks_num,
+                             uint16_t axes_num)
+{
+    assert(p_cache != NULL);
+    assert(p_blocks != NULL);
+    assert((block_size > 0) && (blocks_num > 0));
+
+    p_cache->p_blocks = p_blocks;
+    p_cache->block_size = block_size;
+    p_cache->blocks_num = blocks_num;
+    p_cache->axes_num = axes_num;
+
+    for (uint32_t i = 0; i < (uint32_t)blocks_num * axes_num; i++)
+    {
+        p_blocks[i].is_valid = false;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_stats_cache_window(edgeai_stats_cache_t* p_cache,
+                               uint16_t axis,
+                               const edgeai_span_t* p_span,
+                               uint32_t start,
+                               edgeai_stat_ctx_t* p_ctx,
+                               edgeai_pairwise_t* p_pairwise)
+{
+    assert(axis < p_cache->axes_num);
+
+    const uint16_t block_size = p_cache->block_size;
+    const uint16_t blocks_num = p_cache->blocks_num;
+    edgeai_block_stats_t* p_blocks = &p_cache->p_blocks[axis * blocks_num];
+
+    uint32_t sum = 0;
+    uint32_t abssum = 0;
+    uint64_t tss = 0;
+    uint16_t positive_num = 0;
+    int16_t min = INT16_MAX;
+    int16_t max = INT16_MIN;
+    edgeai_pairwise_t pairwise = { 0 };
+    const edgeai_block_stats_t* p_prev_block = NULL;
+
+    for (uint16_t k = 0; k < blocks_num; k++)
+    {
+        /** Consecutive blocks of the stream take consecutive slots, the oldest block is replaced */
+        const uint32_t block_start = start + (uint32_t)k * block_size;
+        edgeai_block_stats_t* p_block = &p_blocks[(block_start / block_size) % blocks_num];
+
+        if (!p_block->is_valid || (p_block->start != block_start))
+        {
+            edgeai_span_t block_span;
+            edgeai_span_slice(p_span, k * block_size, block_size, &block_span);
+            block_stats_(&block_span, block_start, p_block);
+        }
+
+        sum += (uint32_t)p_block->sum;
+        abssum += p_block->abssum;
+        tss += p_block->tss;
+        positive_num += p_block->positive_num;
+        min = MIN(min, p_block->min);
+        max = MAX(max, p_block->max);
+
+        pairwise.zero_crossings += p_block->pairwise.zero_crossings;
+        pairwise.diff_abssum += p_block->pairwise.diff_abssum;
+        pairwise.diff_square_sum += p_block->pairwise.diff_square_sum;
+        if (p_prev_block != NULL)
+            add_pair_(&pairwise, p_prev_block->last, p_block->first);
+        p_prev_block = p_block;
+    }
+
+    p_ctx->sum = (int32_t)sum;
+    p_ctx->abssum = abssum;
+    p_ctx->tss = tss;
+    p_ctx->positive_num = positive_num;
+    p_ctx->min = min;
+    p_ctx->max = max;
+    *p_pairwise = pairwise;
+}
@@ -0,0 +1,104 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+#ifndef EDGEAI_STATS_CACHE_H__
+#define EDGEAI_STATS_CACHE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "edgeai_features.h"
+
+/**
+ * @brief Statistics of one block of window samples
+ */
+typedef struct edgeai_block_stats_s
+{
+    /** Sum of samples */
+    int32_t sum;
+
+    /** Sum of absolute values of samples */
+    uint32_t abssum;
+
+    /** Total sum of squares of samples */
+    uint64_t tss;
+
+    /** Stream position of the first block sample, identifies the cached block */
+    uint32_t start;
+
+    /** Number of positive samples */
+    uint16_t positive_num;
+
+    /** Minimum and maximum of samples */
+    int16_t min;
+    int16_t max;
+
+    /** First and last samples, neighbors of the samples of the adjacent blocks */
+    int16_t first;
+    int16_t last;
+
+    /** Statistics of the neighbor samples pairs inside the block */
+    edgeai_pairwise_t pairwise;
+
+    /** Block statistics are computed */
+    bool is_valid;
+} edgeai_block_stats_t;
+
+/**
+ * @brief Cache of window statistics split into blocks.
+ *
+ * Window size and shift are both multiples of the block size, so consecutive windows
+ * share all their blocks but the newest ones. Statistics of each block are computed once
+ * and combined for every window containing the block, only the samples added by the
+ * window shift are scanned. Integer statistics are combined exactly, neighbor samples pairs
+ * across the block boundaries are added from the first and last samples of the blocks.
+ */
+typedef struct edgeai_stats_cache_s
+{
+    /** Blocks statistics storage, blocks_num * axes_num entries */
+    edgeai_block_stats_t* p_blocks;
+
+    /** Block size in samples */
+    uint16_t block_size;
+
+    /** Number of blocks in the window */
+    uint16_t blocks_num;
+
+    /** Number of axes */
+    uint16_t axes_num;
+} edgeai_stats_cache_t;
+
+/**
+ * @brief Initialize statistics cache
+ *
+ * @param[in] p_cache     Pointer to the cache context
+ * @param[in] p_blocks    Blocks statistics storage, blocks_num * axes_num entries
+ * @param[in] block_size  Block size in samples, divides both window size and shift
+ * @param[in] blocks_num  Number of blocks in the window
+ * @param[in] axes_num    Number of axes
+ */
+void edgeai_stats_cache_init(edgeai_stats_cache_t* p_cache,
+                             edgeai_block_stats_t* p_blocks,
+                             uint16_t block_size,
+                             uint16_t blocks_num,
+                             uint16_t axes_num);
+
+/**
+ * @brief Get statistics of the axis window, blocks that are not cached yet are computed from the span
+ *
+ * @param[in]  p_cache     Pointer to the cache context
+ * @param[in]  axis        Axis index
+ * @param[in]  p_span      Axis window span, blocks_num * block_size samples
+ * @param[in]  start       Stream position of the first window sample
+ * @param[out] p_ctx       Window statistics
+ * @param[out] p_pairwise  Window neighbor samples statistics
+ */
+void edgeai_stats_cache_window(edgeai_stats_cache_t* p_cache,
+                               uint16_t axis,
+                               const edgeai_span_t* p_span,
+                               uint32_t start,
+                               edgeai_stat_ctx_t* p_ctx,
+                               edgeai_pairwise_t* p_pairwise);
+
+#endif /* EDGEAI_STATS_CACHE_H__ */
@@ -0,0 +1,199 @@
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_window.h"
+#include "edgeai_deinterleave.h"
+
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <assert.h>
+#include <stddef.h>
+
+#include <zephyr/sys/util.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint16_t filled_(const edgeai_window_t* p_window)
+{
+    return (uint16_t)((uint32_t)atomic_get(&p_window->written) - (uint32_t)atomic_get(&p_window->released));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void store_(edgeai_window_t* p_window, const int16_t* p_frames, uint16_t frames_num)
+{
+    const uint16_t capacity = p_window->capacity;
+    const uint16_t axes_num = p_window->axes_num;
+    const uint16_t stored_num = frames_num;
+
+    while (frames_num > 0)
+    {
+        /** Frames are deinterleaved by contiguous runs that end at the ring end */
+        const uint16_t run = MIN(frames_num, capacity - p_window->head);
+
+        edgeai_deinterleave_i16(&p_window->p_buffer[p_window->head], capacity, p_frames, run, axes_num);
+
+        p_frames += run * axes_num;
+        frames_num -= run;
+        p_window->head = (p_window->head + run == capacity) ? 0 : (p_window->head + run);
+    }
+
+    /** Samples are written before they are published to the consumer */
+    atomic_add(&p_window->written, (atomic_val_t)stored_num);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_window_init(edgeai_window_t* p_window,
+                        int16_t* p_buffer,
+                        uint16_t capacity,
+                        uint16_t size,
+                        uint16_t shift,
+                        uint16_t axes_num)
+{
+    assert(p_window != NULL);
+    assert(p_buffer != NULL);
+    assert((shift > 0) && (shift <= size) && (size <= capacity));
+
+    p_window->p_buffer = p_buffer;
+    p_window->capacity = capacity;
+    p_window->size = size;
+    p_window->shift = shift;
+    p_window->axes_num = axes_num;
+    p_window->head = 0;
+    p_window->tail = 0;
+    atomic_set(&p_window->written, 0);
+    atomic_set(&p_window->released, 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint16_t edgeai_window_feed(edgeai_window_t* p_window, const int16_t* p_frames, uint16_t frames_num)
+{
+    const uint16_t size = p_window->size;
+
+    /** Completed window is slid by dropping its oldest samples, they are overwritten in place */
+    if (filled_(p_window) >= size)
+        edgeai_window_slide(p_window);
+
+    uint16_t filled = filled_(p_window);
+    if (filled < size)
+    {
+        store_(p_window, p_frames, MIN(frames_num, size - filled));
+        filled = filled_(p_window);
+    }
+
+    return (filled >= size) ? 0 : (size - filled);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint16_t edgeai_window_push(edgeai_window_t* p_window, const int16_t* p_frames, uint16_t frames_num)
+{
+    frames_num = MIN(frames_num, p_window->capacity - filled_(p_window));
+    store_(p_window, p_frames, frames_num);
+
+    return frames_num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint16_t edgeai_window_ready(const edgeai_window_t* p_window)
+{
+    const uint16_t filled = filled_(p_window);
+
+    if (filled < p_window->size)
+        return 0;
+
+    return 1 + (filled - p_window->size) / p_window->shift;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_window_slide(edgeai_window_t* p_window)
+{
+    assert(filled_(p_window) >= p_window->size);
+
+    const uint16_t tail = p_window->tail + p_window->shift;
+    p_window->tail = (tail >= p_window->capacity) ? (tail - p_window->capacity) : tail;
+
+    /** Window data is read before its oldest samples are returned to the producer */
+    atomic_add(&p_window->released, (atomic_val_t)p_window->shift);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_window_set_shift(edgeai_window_t* p_window, uint16_t shift)
+{
+    assert((shift > 0) && (shift <= p_window->size));
+
+    p_window->shift = shift;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint16_t edgeai_window_samples_left(const edgeai_window_t* p_window)
+{
+    const uint16_t filled = filled_(p_window);
+
+    if (filled >= p_window->size)
+        return p_window->shift;
+
+    return p_window->size - filled;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_window_span(const edgeai_window_t* p_window, uint16_t axis, edgeai_span_t* p_span)
+{
+    assert(axis < p_window->axes_num);
+
+    const uint16_t capacity = p_window->capacity;
+    const int16_t* p_column = &p_window->p_buffer[axis * capacity];
+    const uint16_t num = MIN(filled_(p_window), p_window->size);
+    const uint16_t start = p_window->tail;
+
+    if (num <= capacity - start)
+    {
+        p_span->p_seg[0] = &p_column[start];
+        p_span->num[0] = num;
+        p_span->p_seg[1] = NULL;
+        p_span->num[1] = 0;
+    }
+    else
+    {
+        /** Oldest samples are at the ring end, the newest ones continue from the ring start */
+        p_span->p_seg[0] = &p_column[start];
+        p_span->num[0] = capacity - start;
+        p_span->p_seg[1] = p_column;
+        p_span->num[1] = num - (capacity - start);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint32_t edgeai_window_start(const edgeai_window_t* p_window)
+{
+    return (uint32_t)atomic_get(&p_window->released);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void edgeai_span_slice(const edgeai_span_t* p_span, uint16_t offset, uint16_t num, edgeai_span_t* p_slice)
+{
+    assert(offset + num <= p_span->num[0] + p_span->num[1]);
+
+    if (offset >= p_span->num[0])
+    {
+        p_slice->p_seg[0] = &p_span->p_seg[1][offset - p_span->num[0]];
+        p_slice->num[0] = num;
+        p_slice->p_seg[1] = NULL;
+        p_slice->num[1] = 0;
+    }
+    else
+    {
+        const uint16_t first_num = MIN(num, p_span->num[0] - offset);
+
+        p_slice->p_seg[0] = &p_span->p_seg[0][offset];
+        p_slice->num[0] = first_num;
+        p_slice->p_seg[1] = (num > first_num) ? p_span->p_seg[1] : NULL;
+        p_slice->num[1] = num - first_num;
+    }
+}
@@ -0,0 +1,173 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+#ifndef EDGEAI_WINDOW_H__
+#define EDGEAI_WINDOW_H__
+
+#include <stdint.h>
+#include <zephyr/sys/atomic.h>
+
+/**
+ * @brief Part of the window column that may wrap around the end of the ring,
+ *        oldest samples are in the first segment.
+ */
+typedef struct edgeai_span_s
+{
+    /** Segments data, the second one continues the first one */
+    const int16_t* p_seg[2];
+
+    /** Number of samples in each segment, the first one is empty only if the span is empty */
+    uint16_t num[2];
+} edgeai_span_t;
+
+/**
+ * @brief Sliding window of model inputs stored as per-axis rings.
+ *
+ * Same collecting behavior as the library flatten sliding window, but the window
+ * is slid by advancing the ring head instead of moving the columns in memory.
+ * The window column of each axis is read in place as a two-segment span.
+ * Rings longer than the window keep collecting past the completed window, so
+ * several overlapping windows can be ready at once, the oldest one is read first.
+ *
+ * Samples are pushed by a single producer and windows are read and slid by a single
+ * consumer, possibly on different threads. The producer writes the free space only,
+ * so a complete window stays unchanged until the consumer slides it. Sample counters
+ * are free running, each one is updated only by its owner.
+ */
+typedef struct edgeai_window_s
+{
+    /** Columns storage, capacity * axes_num values, each column is a ring of capacity samples */
+    int16_t* p_buffer;
+
+    /** Ring capacity in samples, at least the window size */
+    uint16_t capacity;
+
+    /** Window size in samples */
+    uint16_t size;
+
+    /** Window shift in samples */
+    uint16_t shift;
+
+    /** Number of axes in one input frame */
+    uint16_t axes_num;
+
+    /** Ring position of the next sample, producer side */
+    uint16_t head;
+
+    /** Ring position of the oldest window start, consumer side */
+    uint16_t tail;
+
+    /** Samples pushed by the producer */
+    atomic_t written;
+
+    /** Samples dropped by the consumer sliding the window */
+    atomic_t released;
+} edgeai_window_t;
+
+/**
+ * @brief Initialize ring window
+ *
+ * @param[in] p_window  Pointer to the window context
+ * @param[in] p_buffer  Columns storage, capacity * axes_num values
+ * @param[in] capacity  Ring capacity in samples, at least the window size
+ * @param[in] size      Window size in samples
+ * @param[in] shift     Window shift in samples
+ * @param[in] axes_num  Number of axes in one input frame
+ */
+void edgeai_window_init(edgeai_window_t* p_window,
+                        int16_t* p_buffer,
+                        uint16_t capacity,
+                        uint16_t size,
+                        uint16_t shift,
+                        uint16_t axes_num);
+
+/**
+ * @brief Feed interleaved input frames to the window.
+ *        Completed window is slid on the next feed, frames beyond the completed window are ignored.
+ *        Both producer and consumer side, for a window used by one thread only.
+ *
+ * @param[in] p_window   Pointer to the window context
+ * @param[in] p_frames   Interleaved input frames, axes_num values each
+ * @param[in] frames_num Number of input frames
+ *
+ * @return Number of samples left to complete the window, 0 if the window is complete
+ */
+uint16_t edgeai_window_feed(edgeai_window_t* p_window, const int16_t* p_frames, uint16_t frames_num);
+
+/**
+ * @brief Store interleaved input frames in the ring as long as it has free space.
+ *        Completed windows are kept until they are slid explicitly. Producer side only.
+ *
+ * @param[in] p_window   Pointer to the window context
+ * @param[in] p_frames   Interleaved input frames, axes_num values each
+ * @param[in] frames_num Number of input frames
+ *
+ * @return Number of stored frames
+ */
+uint16_t edgeai_window_push(edgeai_window_t* p_window, const int16_t* p_frames, uint16_t frames_num);
+
+/**
+ * @brief Get number of complete windows collected in the ring
+ *
+ * @param[in] p_window  Pointer to the window context
+ *
+ * @return Number of complete windows
+ */
+uint16_t edgeai_window_ready(const edgeai_window_t* p_window);
+
+/**
+ * @brief Slide the window by its shift, dropping the oldest complete window. Consumer side only.
+ *
+ * @param[in] p_window  Pointer to the window context, at least one window must be complete
+ */
+void edgeai_window_slide(edgeai_window_t* p_window);
+
+/**
+ * @brief Change the window shift, the next slide moves the window by the new shift.
+ *        Consumer side only.
+ *
+ * @param[in] p_window  Pointer to the window context
+ * @param[in] shift     Window shift in samples, up to the window size
+ */
+void edgeai_window_set_shift(edgeai_window_t* p_window, uint16_t shift);
+
+/**
+ * @brief Get number of samples the window needs to be completed on the next feed
+ *
+ * @param[in] p_window  Pointer to the window context
+ *
+ * @return Number of samples, window shift if the window is complete now
+ */
+uint16_t edgeai_window_samples_left(const edgeai_window_t* p_window);
+
+/**
+ * @brief Get collected samples of the oldest window axis column, oldest first. Consumer side only.
+ *
+ * @param[in]  p_window  Pointer to the window context
+ * @param[in]  axis      Axis index
+ * @param[out] p_span    Column span
+ */
+void edgeai_window_span(const edgeai_window_t* p_window, uint16_t axis, edgeai_span_t* p_span);
+
+/**
+ * @brief Get stream position of the oldest window, number of samples slid out of the window so far.
+ *        Consumer side only.
+ *
+ * @param[in] p_window  Pointer to the window context
+ *
+ * @return Stream position of the first window sample, wraps around at 2^32
+ */
+uint32_t edgeai_window_start(const edgeai_window_t* p_window);
+
+/**
+ * @brief Get part of the span
+ *
+ * @param[in]  p_span    Span
+ * @param[in]  offset    Offset of the first sample of the part
+ * @param[in]  num       Number of samples in the part, offset + num is within the span
+ * @param[out] p_slice   Span of the part
+ */
+void edgeai_span_slice(const edgeai_span_t* p_span, uint16_t offset, uint16_t num, edgeai_span_t* p_slice);
+
+#endif /* EDGEAI_WINDOW_H__ */
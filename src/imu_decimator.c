@@ -0,0 +1,153 @@
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "imu_decimator.h"
+
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <zephyr/sys/util.h>
+
+///
+/** Filter cutoff (-6 dB) relative to the output Nyquist frequency, Blackman window
+ *  stopband starts above the output Nyquist, so aliases land only in the top of the output band
+ */
+#define DECIMATOR_CUTOFF_RATIO          (0.8f)
+#define DECIMATOR_COEFF_Q               (15)
+#define DECIMATOR_COEFF_ONE             (1 << DECIMATOR_COEFF_Q)
+#define DECIMATOR_PI                    (3.14159265358979f)
+///
+
+//////////////////////////////////////////////////////////////////////////////
+
+static float blackman_sinc_(uint16_t n, uint16_t taps_num, float cutoff)
+{
+    const float t = n - (taps_num - 1) / 2.0f;
+    const float sinc = (t == 0) ? 1.0f : sinf(2 * DECIMATOR_PI * cutoff * t) / (2 * DECIMATOR_PI * cutoff * t);
+    const float phase = 2 * DECIMATOR_PI * n / (taps_num - 1);
+    const float window = 0.42f - 0.5f * cosf(phase) + 0.08f * cosf(2 * phase);
+
+    return sinc * window;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void design_lowpass_(int16_t* p_coeffs, uint16_t taps_num, uint8_t ratio)
+{
+    /** Cutoff in cycles per input sample */
+    const float cutoff = DECIMATOR_CUTOFF_RATIO * 0.5f / ratio;
+    float sum = 0;
+
+    for (uint16_t n = 0; n < taps_num; n++)
+    {
+        sum += blackman_sinc_(n, taps_num, cutoff);
+    }
+
+    /** Quantize with unity DC gain, so constant signals (gravity) pass unchanged */
+    int32_t qsum = 0;
+    uint32_t abs_sum = 0;
+    for (uint16_t n = 0; n < taps_num; n++)
+    {
+        p_coeffs[n] = (int16_t)lroundf(blackman_sinc_(n, taps_num, cutoff) / sum * DECIMATOR_COEFF_ONE);
+        qsum += p_coeffs[n];
+    }
+
+    const int32_t residual = DECIMATOR_COEFF_ONE - qsum;
+    p_coeffs[taps_num / 2 - 1] += residual / 2;
+    p_coeffs[taps_num / 2] += residual - residual / 2;
+
+    for (uint16_t n = 0; n < taps_num; n++)
+    {
+        abs_sum += (p_coeffs[n] < 0) ? -p_coeffs[n] : p_coeffs[n];
+    }
+
+    /** int32 accumulator can't overflow for any int16 input */
+    assert(abs_sum < (1U << 16));
+    (void)abs_sum;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void imu_decimator_init(imu_decimator_t* p_dec,
+                        uint8_t ratio,
+                        uint8_t frame_len,
+                        int16_t* p_coeffs,
+                        int16_t* p_history)
+{
+    assert(p_dec != NULL);
+    assert(ratio > 0);
+
+    p_dec->p_coeffs = p_coeffs;
+    p_dec->p_history = p_history;
+    p_dec->ratio = ratio;
+    p_dec->frame_len = frame_len;
+    p_dec->phase = ratio;
+    p_dec->pos = 0;
+    p_dec->taps_num = 0;
+
+    if (ratio > 1)
+    {
+        assert((p_coeffs != NULL) && (p_history != NULL));
+
+        p_dec->taps_num = IMU_DECIMATOR_TAPS(ratio);
+        design_lowpass_(p_coeffs, p_dec->taps_num, ratio);
+        memset(p_history, 0, IMU_DECIMATOR_HISTORY_LEN(ratio, frame_len) * sizeof(int16_t));
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint16_t imu_decimator_process(imu_decimator_t* p_dec,
+                               const int16_t* p_in,
+                               uint16_t frames_num,
+                               int16_t* p_out)
+{
+    const uint16_t taps_num = p_dec->taps_num;
+    const uint8_t frame_len = p_dec->frame_len;
+    uint16_t out_frames = 0;
+
+    if (p_dec->ratio <= 1)
+    {
+        if (p_out != p_in)
+            memmove(p_out, p_in, frames_num * frame_len * sizeof(int16_t));
+        return frames_num;
+    }
+
+    for (uint16_t frame = 0; frame < frames_num; frame++)
+    {
+        const int16_t* p_frame = &p_in[frame * frame_len];
+
+        /** Newest sample is stored before the previous one, in both copies of the delay line */
+        p_dec->pos = (p_dec->pos == 0) ? (taps_num - 1) : (p_dec->pos - 1);
+        for (uint8_t axis = 0; axis < frame_len; axis++)
+        {
+            int16_t* p_line = &p_dec->p_history[axis * 2 * taps_num];
+            p_line[p_dec->pos] = p_frame[axis];
+            p_line[p_dec->pos + taps_num] = p_frame[axis];
+        }
+
+        if (--p_dec->phase > 0)
+            continue;
+
+        p_dec->phase = p_dec->ratio;
+
+        /** Output index never passes the input index, so the output can overwrite consumed input */
+        int16_t* p_out_frame = &p_out[out_frames * frame_len];
+        for (uint8_t axis = 0; axis < frame_len; axis++)
+        {
+            const int16_t* p_window = &p_dec->p_history[axis * 2 * taps_num + p_dec->pos];
+            int32_t acc = 1 << (DECIMATOR_COEFF_Q - 1);
+
+            for (uint16_t k = 0; k < taps_num; k++)
+            {
+                acc += (int32_t)p_dec->p_coeffs[k] * p_window[k];
+            }
+
+            p_out_frame[axis] = (int16_t)CLAMP(acc >> DECIMATOR_COEFF_Q, INT16_MIN, INT16_MAX);
+        }
+        out_frames++;
+    }
+
+    return out_frames;
+}
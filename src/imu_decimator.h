@@ -0,0 +1,80 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+#ifndef IMU_DECIMATOR_H__
+#define IMU_DECIMATOR_H__
+
+#include <stdint.h>
+
+/** Number of FIR taps per unit of decimation ratio */
+#define IMU_DECIMATOR_TAPS_PER_RATIO    (16)
+
+/** Number of FIR taps for the decimation ratio */
+#define IMU_DECIMATOR_TAPS(ratio)       ((ratio) * IMU_DECIMATOR_TAPS_PER_RATIO)
+
+/** Length of the delay line storage in values for the decimation ratio and frame length */
+#define IMU_DECIMATOR_HISTORY_LEN(ratio, frame_len) (2 * IMU_DECIMATOR_TAPS(ratio) * (frame_len))
+
+/**
+ * @brief Fixed-point decimator of interleaved IMU frames.
+ *
+ * Each axis is filtered by the same Q15 low-pass FIR and only every ratio-th output is kept.
+ * The filter is evaluated for the kept outputs only, which costs the same as the polyphase form.
+ * Delay line of every axis is stored twice, so the filter window is always contiguous.
+ */
+typedef struct imu_decimator_s
+{
+    /** FIR coefficients in Q15, DC gain is exactly 1 */
+    int16_t* p_coeffs;
+
+    /** Delay lines, 2 * taps_num values per axis */
+    int16_t* p_history;
+
+    /** Number of FIR taps */
+    uint16_t taps_num;
+
+    /** Position of the newest sample in the delay lines */
+    uint16_t pos;
+
+    /** Decimation ratio */
+    uint8_t ratio;
+
+    /** Number of values (axes) in one frame */
+    uint8_t frame_len;
+
+    /** Input frames left until the next output */
+    uint8_t phase;
+} imu_decimator_t;
+
+/**
+ * @brief Initialize IMU decimator and design its low-pass filter
+ *
+ * @param[in] p_dec     Pointer to the decimator context
+ * @param[in] ratio     Decimation ratio, 1 passes frames through
+ * @param[in] frame_len Number of values (axes) in one frame
+ * @param[in] p_coeffs  Coefficients storage, @ref IMU_DECIMATOR_TAPS values
+ * @param[in] p_history Delay lines storage, @ref IMU_DECIMATOR_HISTORY_LEN values
+ */
+void imu_decimator_init(imu_decimator_t* p_dec,
+                        uint8_t ratio,
+                        uint8_t frame_len,
+                        int16_t* p_coeffs,
+                        int16_t* p_history);
+
+/**
+ * @brief Decimate IMU frames, output may be written in place of the input
+ *
+ * @param[in]  p_dec      Pointer to the decimator context
+ * @param[in]  p_in       Input interleaved frames
+ * @param[in]  frames_num Number of input frames
+ * @param[out] p_out      Output interleaved frames, may be the same buffer as p_in
+ *
+ * @return Number of output frames
+ */
+uint16_t imu_decimator_process(imu_decimator_t* p_dec,
+                               const int16_t* p_in,
+                               uint16_t frames_num,
+                               int16_t* p_out);
+
+#endif /* IMU_DECIMATOR_H__ */
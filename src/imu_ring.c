@@ -0,0 +1,82 @@
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "imu_ring.h"
+
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <assert.h>
+#include <stddef.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+void imu_ring_init(imu_ring_t* p_ring, int16_t* p_buffer, uint16_t frame_len, uint32_t capacity)
+{
+    assert(p_ring != NULL);
+    assert(p_buffer != NULL);
+    assert((capacity > 0) && ((capacity & (capacity - 1)) == 0));
+
+    p_ring->p_buffer = p_buffer;
+    p_ring->frame_len = frame_len;
+    p_ring->capacity = capacity;
+    atomic_set(&p_ring->write_idx, 0);
+    atomic_set(&p_ring->read_idx, 0);
+    atomic_set(&p_ring->overruns, 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint32_t imu_ring_write_span(imu_ring_t* p_ring, int16_t** pp_frames)
+{
+    const uint32_t write_idx = (uint32_t)atomic_get(&p_ring->write_idx);
+    const uint32_t read_idx = (uint32_t)atomic_get(&p_ring->read_idx);
+    const uint32_t offset = write_idx & (p_ring->capacity - 1);
+    const uint32_t free_frames = p_ring->capacity - (write_idx - read_idx);
+    const uint32_t to_end = p_ring->capacity - offset;
+
+    *pp_frames = &p_ring->p_buffer[offset * p_ring->frame_len];
+
+    return (free_frames < to_end) ? free_frames : to_end;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void imu_ring_write_commit(imu_ring_t* p_ring, uint32_t frames_num)
+{
+    /** Frames data is written before the index is published to the consumer */
+    atomic_add(&p_ring->write_idx, (atomic_val_t)frames_num);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void imu_ring_write_overrun(imu_ring_t* p_ring, uint32_t frames_num)
+{
+    atomic_add(&p_ring->overruns, (atomic_val_t)frames_num);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint32_t imu_ring_read_span(imu_ring_t* p_ring, const int16_t** pp_frames)
+{
+    const uint32_t read_idx = (uint32_t)atomic_get(&p_ring->read_idx);
+    const uint32_t write_idx = (uint32_t)atomic_get(&p_ring->write_idx);
+    const uint32_t offset = read_idx & (p_ring->capacity - 1);
+    const uint32_t used_frames = write_idx - read_idx;
+    const uint32_t to_end = p_ring->capacity - offset;
+
+    *pp_frames = &p_ring->p_buffer[offset * p_ring->frame_len];
+
+    return (used_frames < to_end) ? used_frames : to_end;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void imu_ring_read_release(imu_ring_t* p_ring, uint32_t frames_num)
+{
+    /** Frames data is consumed before the space is returned to the producer */
+    atomic_add(&p_ring->read_idx, (atomic_val_t)frames_num);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint32_t imu_ring_overruns(const imu_ring_t* p_ring)
+{
+    return (uint32_t)atomic_get(&p_ring->overruns);
+}
@@ -0,0 +1,104 @@
+/*
+* Copyright (c) 2024 Nordic Semiconductor ASA
+* SPDX-License-Identifier: Apache-2.0
+*/
+#ifndef IMU_RING_H__
+#define IMU_RING_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <zephyr/sys/atomic.h>
+
+/**
+ * @brief Lock-free single producer / single consumer ring of IMU frames.
+ *
+ * Producer and consumer access the frames in place through contiguous spans,
+ * so the producer can read sensor data directly into the ring and the consumer
+ * can feed it to the model without extra copies. Read and write indexes are
+ * free running counters, each one is updated only by its owner.
+ */
+typedef struct imu_ring_s
+{
+    /** Frames storage, capacity * frame_len values */
+    int16_t* p_buffer;
+
+    /** Number of values in one frame */
+    uint16_t frame_len;
+
+    /** Ring capacity in frames, power of two */
+    uint32_t capacity;
+
+    /** Frames written by the producer */
+    atomic_t write_idx;
+
+    /** Frames read by the consumer */
+    atomic_t read_idx;
+
+    /** Frames dropped by the producer because the ring was full */
+    atomic_t overruns;
+} imu_ring_t;
+
+/**
+ * @brief Initialize IMU frames ring
+ *
+ * @param[in] p_ring    Pointer to the ring context
+ * @param[in] p_buffer  Frames storage, capacity * frame_len values
+ * @param[in] frame_len Number of values in one frame
+ * @param[in] capacity  Ring capacity in frames, must be power of two
+ */
+void imu_ring_init(imu_ring_t* p_ring, int16_t* p_buffer, uint16_t frame_len, uint32_t capacity);
+
+/**
+ * @brief Get contiguous free space of the ring, producer side only
+ *
+ * @param[in]  p_ring      Pointer to the ring context
+ * @param[out] pp_frames   Pointer to the first free frame
+ *
+ * @return Number of frames that can be written at pp_frames, 0 if the ring is full
+ */
+uint32_t imu_ring_write_span(imu_ring_t* p_ring, int16_t** pp_frames);
+
+/**
+ * @brief Publish frames written to the span returned by @ref imu_ring_write_span, producer side only
+ *
+ * @param[in] p_ring     Pointer to the ring context
+ * @param[in] frames_num Number of written frames
+ */
+void imu_ring_write_commit(imu_ring_t* p_ring, uint32_t frames_num);
+
+/**
+ * @brief Account frames dropped by the producer because the ring was full
+ *
+ * @param[in] p_ring     Pointer to the ring context
+ * @param[in] frames_num Number of dropped frames
+ */
+void imu_ring_write_overrun(imu_ring_t* p_ring, uint32_t frames_num);
+
+/**
+ * @brief Get contiguous filled space of the ring, consumer side only
+ *
+ * @param[in]  p_ring      Pointer to the ring context
+ * @param[out] pp_frames   Pointer to the oldest frame
+ *
+ * @return Number of frames available at pp_frames, 0 if the ring is empty
+ */
+uint32_t imu_ring_read_span(imu_ring_t* p_ring, const int16_t** pp_frames);
+
+/**
+ * @brief Release frames consumed from the span returned by @ref imu_ring_read_span, consumer side only
+ *
+ * @param[in] p_ring     Pointer to the ring context
+ * @param[in] frames_num Number of consumed frames
+ */
+void imu_ring_read_release(imu_ring_t* p_ring, uint32_t frames_num);
+
+/**
+ * @brief Get total number of frames dropped because the ring was full
+ *
+ * @param[in] p_ring    Pointer to the ring context
+ *
+ * @return Number of dropped frames since ring initialization
+ */
+uint32_t imu_ring_overruns(const imu_ring_t* p_ring);
+
+#endif /* IMU_RING_H__ */
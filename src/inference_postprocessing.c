@@ -7,6 +7,16 @@
 
 ///
 #define PREVIOUS_PREDICTION_NUM                 (3)
+
+#if CONFIG_EDGEAI_FIXED_POINT_OUTPUT
+/** Fixed-point probability threshold, UINT16_MAX * UINT16_MAX is 1.0, so the average of the Q16
+ *  probabilities is compared with the threshold without rounding, as the float average is */
+typedef uint32_t probability_threshold_t;
+#define PROBABILITY(value)                      ((probability_threshold_t)((value) * ((uint64_t)UINT16_MAX * UINT16_MAX)))
+#else
+typedef float probability_threshold_t;
+#define PROBABILITY(value)                      ((probability_threshold_t)(value))
+#endif
 ///
 
 //////////////////////////////////////////////////////////////////////////////
@@ -17,7 +27,7 @@ typedef struct prediction_ctx_s
     uint16_t target;
 
     /** Prediction probability */
-    float probability;
+    inference_probability_t probability;
 } prediction_ctx_t;
 
 typedef struct prediction_tracer_s
@@ -42,7 +52,7 @@ typedef struct class_prediction_condition_s
     uint16_t min_repeat_count;
 
     /** Minimum probability threshold for prediction */
-    float probability_threshold;
+    probability_threshold_t probability_threshold;
 } class_prediction_condition_t;
 
 //////////////////////////////////////////////////////////////////////////////
@@ -53,12 +63,12 @@ static const char* get_name_by_target_(uint8_t predicted_target);
 //////////////////////////////////////////////////////////////////////////////
 
 void inference_postprocess(const uint16_t predicted_target,
-                            const float prob,
+                            const inference_probability_t prob,
                             const bool do_postprocessing,
                             inference_postprocess_cb_t callback)
 {
     uint16_t target = predicted_target;
-    float probability = prob;
+    inference_probability_t probability = prob;
     
     static prediction_tracer_t tracer_ = {0U};
 
@@ -89,6 +99,19 @@ void inference_postprocess(const uint16_t predicted_target,
             /** Сlass is labled as CLASS_LABEL_UNKNOWN if the number of repetitions does not exceed the threshold */
             if (tracer_.index >= class_condition->min_repeat_count) {
                 /** Calculate average probability for last N predictions of the same class */
+#if CONFIG_EDGEAI_FIXED_POINT_OUTPUT
+                uint32_t probability_sum = 0;
+
+                for (int i = 0; i < tracer_.index; ++i)
+                    probability_sum += tracer_.prev[i].probability;
+
+                inference_probability_t average_prob =
+                    (inference_probability_t)((probability_sum + tracer_.index / 2) / tracer_.index);
+
+                /** Sum / index < threshold / UINT16_MAX, compared without dividing */
+                const bool is_below_threshold = ((uint64_t)probability_sum * UINT16_MAX) <
+                                                ((uint64_t)class_condition->probability_threshold * tracer_.index);
+#else
                 float average_prob = 0.0f;
 
                 for (int i = 0; i < tracer_.index; ++i)
@@ -96,9 +119,12 @@ void inference_postprocess(const uint16_t predicted_target,
 
                 average_prob = average_prob / tracer_.index;
 
+                const bool is_below_threshold = (average_prob < class_condition->probability_threshold);
+#endif
+
                 /** If average probability is less the class probability threshold,
                  * the class is labled as CLASS_LABEL_UNKNOWN */
-                if (average_prob < class_condition->probability_threshold)
+                if (is_below_threshold)
                     target = CLASS_LABEL_UNKNOWN;
                 else
                     probability = average_prob;
@@ -145,14 +171,14 @@ static const class_prediction_condition_t* get_class_condition_(uint8_t predicte
 {
     static const class_prediction_condition_t LABEL_VS_CONFIG[] = 
     {
-        [CLASS_LABEL_IDLE]           = {0, 0.0},
-        [CLASS_LABEL_UNKNOWN]        = {0, 0.0},
-        [CLASS_LABEL_SWIPE_LEFT]     = {2, 0.8},
-        [CLASS_LABEL_SWIPE_RIGHT]    = {2, 0.8},
-        [CLASS_LABEL_DOUBLE_SHAKE]   = {2, 0.7},
-        [CLASS_LABEL_DOUBLE_THUMB]   = {2, 0.7},
-        [CLASS_LABEL_ROTATION_RIGHT] = {2, 0.7},
-        [CLASS_LABEL_ROTATION_LEFT]  = {2, 0.7},
+        [CLASS_LABEL_IDLE]           = {0, PROBABILITY(0.0)},
+        [CLASS_LABEL_UNKNOWN]        = {0, PROBABILITY(0.0)},
+        [CLASS_LABEL_SWIPE_LEFT]     = {2, PROBABILITY(0.8)},
+        [CLASS_LABEL_SWIPE_RIGHT]    = {2, PROBABILITY(0.8)},
+        [CLASS_LABEL_DOUBLE_SHAKE]   = {2, PROBABILITY(0.7)},
+        [CLASS_LABEL_DOUBLE_THUMB]   = {2, PROBABILITY(0.7)},
+        [CLASS_LABEL_ROTATION_RIGHT] = {2, PROBABILITY(0.7)},
+        [CLASS_LABEL_ROTATION_LEFT]  = {2, PROBABILITY(0.7)},
     };
 
     static const uint8_t LABELS_CNT = sizeof(LABEL_VS_CONFIG) / sizeof(LABEL_VS_CONFIG[0]);
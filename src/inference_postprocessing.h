@@ -8,6 +8,13 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#if CONFIG_EDGEAI_FIXED_POINT_OUTPUT
+/** Fixed-point probability, UINT16_MAX is 1.0 */
+typedef uint16_t inference_probability_t;
+#else
+typedef float inference_probability_t;
+#endif
+
 typedef enum
 {
     CLASS_LABEL_IDLE,            ///< CLASS_LABEL_IDLE
@@ -30,7 +37,7 @@ typedef enum
  * 
  */
 typedef void (*inference_postprocess_cb_t)(const class_label_t class_label, 
-                                            const float probability,
+                                            const inference_probability_t probability,
                                             const char* class_name,
                                             const bool is_raw);
 
@@ -43,10 +50,25 @@ typedef void (*inference_postprocess_cb_t)(const class_label_t class_label,
  * @param[in] callback          Inference Result (prediction) ready user callback, @ref inference_postprocess_cb_t 
  */
 void inference_postprocess(const uint16_t predicted_target,
-                            const float probability,
+                            const inference_probability_t probability,
                             const bool do_postprocessing,
                             inference_postprocess_cb_t callback);
 
+/**
+ * @brief Convert the probability to whole percents, rounded down
+ * 
+ * @param[in] probability   Probability
+ * 
+ * @return Percents
+ */
+static inline int inference_probability_percent(const inference_probability_t probability)
+{
+#if CONFIG_EDGEAI_FIXED_POINT_OUTPUT
+    return (int)(((uint32_t)probability * 100U) / UINT16_MAX);
+#else
+    return (int)(probability * 100.0f);
+#endif
+}
 
 
 #endif /* INFERENCE_POSTPROCESSING_H__ */
@@ -14,6 +14,7 @@
 #include <zephyr/device.h>
 #include <zephyr/kernel.h>
 #include <zephyr/usb/usb_device.h>
+#include <zephyr/sys/atomic.h>
 
 #include <nrf_edgeai/nrf_edgeai.h>
 #include <nrf_edgeai_generated/nrf_edgeai_user_model.h>
@@ -24,6 +25,10 @@
 
 #include "ble/hid/ble_hid.h"
 #include "inference_postprocessing.h"
+#include "imu_ring.h"
+#include "imu_decimator.h"
+#include "edgeai_runtime.h"
+#include "edgeai_benchmark.h"
 #include "app_version.h"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -32,6 +37,43 @@
 #define GYRO_AXIS_NUM (3U)
 #define NRF_EDGEAI_INPUT_DATA_LEN (ACCEL_AXIS_NUM + GYRO_AXIS_NUM)
 
+/** Model is trained on 100 Hz data, IMU is oversampled by the decimation ratio */
+#define IMU_MODEL_DATA_RATE_HZ (100)
+#define IMU_DATA_RATE_HZ (IMU_MODEL_DATA_RATE_HZ * CONFIG_IMU_DECIMATION_RATIO)
+
+BUILD_ASSERT((CONFIG_IMU_DECIMATION_RATIO & (CONFIG_IMU_DECIMATION_RATIO - 1)) == 0,
+             "IMU data rates are 100 Hz times power of two");
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_IMU_RING_FRAMES),
+             "IMU frames ring indexes are masked by the ring capacity");
+
+#if CONFIG_IMU_FIFO_WATERMARK_FRAMES > 0
+/** Watermark is configured in model rate frames, the sensor batches decimation ratio times more */
+#define IMU_FIFO_WATERMARK_FRAMES MIN(CONFIG_IMU_FIFO_WATERMARK_FRAMES * CONFIG_IMU_DECIMATION_RATIO, \
+                                      BSP_IMU_FIFO_WATERMARK_FRAMES_MAX)
+/** Max frames per sensor read, also the size of the scratch buffer used to drain the sensor on ring overrun */
+#define IMU_FRAMES_BUFFER_SIZE (2 * IMU_FIFO_WATERMARK_FRAMES)
+#else
+#define IMU_FIFO_WATERMARK_FRAMES (0)
+#define IMU_FRAMES_BUFFER_SIZE (1)
+#endif
+
+#define IMU_ACQUISITION_THREAD_STACK_SIZE (1024)
+#if CONFIG_BSP_IMU_REPLAY_MAX_SPEED
+/** Unpaced replay runs below the main thread and inference, so every batch is consumed before the next one is read */
+#define IMU_ACQUISITION_THREAD_PRIORITY K_PRIO_PREEMPT(CONFIG_MAIN_THREAD_PRIORITY + 2)
+#else
+/** IMU acquisition runs above the main thread, so inference latency does not delay sensor reads */
+#define IMU_ACQUISITION_THREAD_PRIORITY K_PRIO_COOP(1)
+#endif
+
+#define INFERENCE_THREAD_STACK_SIZE (2048)
+/** Inference runs below the main thread feeding the model, which keeps collecting the next windows */
+#define INFERENCE_THREAD_PRIORITY K_PRIO_PREEMPT(CONFIG_MAIN_THREAD_PRIORITY + 1)
+
+/** Number of feature extractions and inferences averaged by the startup benchmarks */
+#define FEATURES_BENCHMARK_RUNS (100)
+#define INFERENCE_BENCHMARK_RUNS (100)
+
 #define BLINK_LED_TIMER_PERIOD_MS (30)
 #define LED_MAX_BRIGHTNESS (0.2f)
 #define LED_BLINK_CHANGE_BRIGHTNESS_STEP (0.005f)
@@ -77,12 +119,26 @@ typedef int (*led_set_func_t)(float brightness);
 static void board_support_init_(void);
 static void led_glowing_timer_handler_(struct k_timer* timer);
 static void imu_data_ready_cb_(void);
+static void imu_acquisition_thread_(void* p1, void* p2, void* p3);
+static uint16_t imu_ring_span_(int16_t** pp_frames);
+static uint16_t imu_ring_publish_(int16_t* p_frames, uint16_t frames_num);
+#if CONFIG_BSP_IMU_REPLAY_MAX_SPEED
+static void imu_replay_wait_ring_(void);
+#endif
+#if CONFIG_IMU_ASYNC_READ
+static void imu_async_read_done_(void* data, uint32_t data_size);
+#else
+static bsp_status_t imu_read_frames_(int16_t* p_frames, uint16_t max_frames, uint16_t* p_frames_num);
+#endif
 static void ble_connection_cb_(bool connected);
 static void button_click_handler_(bool pressed);
+static uint16_t process_imu_frames_(const int16_t* p_frames, uint16_t frames_num);
 #ifndef CONFIG_DATA_COLLECTION_MODE
+static void inference_thread_(void* p1, void* p2, void* p3);
+static void model_output_handler_(nrf_edgeai_t* p_edgeai);
 static void send_bt_keyboard_key_(const class_label_t class_label);
 static void model_prediction_handler_(const class_label_t class_label, 
-                                        const float probability,
+                                        const inference_probability_t probability,
                                         const char* class_name,
                                         const bool is_raw);
 #endif
@@ -95,11 +151,41 @@ static void button_work_handler(struct k_work *work);
 static bool ble_connected_ = false;
 static app_remotectrl_mode_t keyboard_ctrl_mode_ = APP_REMOTECTRL_MODE_MUSIC;
 static struct k_sem imu_data_ready_sem_;
+static struct k_sem imu_frames_ready_sem_;
+static struct k_sem model_windows_ready_sem_;
 
 // Work queue items for deferring interrupt context LED operations to thread context
 static struct k_work led_update_work;
 static struct k_work button_work;
 static nrf_edgeai_t* p_model_ = NULL;
+static int16_t imu_frames_[IMU_FRAMES_BUFFER_SIZE * NRF_EDGEAI_INPUT_DATA_LEN];
+static int16_t imu_ring_buffer_[CONFIG_IMU_RING_FRAMES * NRF_EDGEAI_INPUT_DATA_LEN];
+#if CONFIG_EDGEAI_WINDOW_RING_FRAMES > 0
+static int16_t model_window_ring_[CONFIG_EDGEAI_WINDOW_RING_FRAMES * NRF_EDGEAI_INPUT_DATA_LEN];
+#endif
+static imu_ring_t imu_ring_;
+#if CONFIG_IMU_DECIMATION_RATIO > 1
+static imu_decimator_t imu_decimator_;
+static int16_t imu_decimator_coeffs_[IMU_DECIMATOR_TAPS(CONFIG_IMU_DECIMATION_RATIO)];
+static int16_t imu_decimator_history_[IMU_DECIMATOR_HISTORY_LEN(CONFIG_IMU_DECIMATION_RATIO, NRF_EDGEAI_INPUT_DATA_LEN)];
+#endif
+static struct k_thread imu_acquisition_thread_data_;
+#ifndef CONFIG_DATA_COLLECTION_MODE
+static struct k_thread inference_thread_data_;
+#endif
+#if CONFIG_IMU_ASYNC_READ
+/** IMU interrupts not served by a read yet, counted so that interrupts coming while a read is in flight are kept */
+static atomic_t imu_async_pending_ = ATOMIC_INIT(0);
+/** Asynchronous read completed, its frames are published by the acquisition thread */
+static atomic_t imu_async_done_ = ATOMIC_INIT(0);
+static int16_t* p_imu_async_frames_ = NULL;
+static uint16_t imu_async_frames_num_ = 0;
+#endif
+
+K_THREAD_STACK_DEFINE(imu_acquisition_thread_stack_, IMU_ACQUISITION_THREAD_STACK_SIZE);
+#ifndef CONFIG_DATA_COLLECTION_MODE
+K_THREAD_STACK_DEFINE(inference_thread_stack_, INFERENCE_THREAD_STACK_SIZE);
+#endif
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -117,9 +203,59 @@ int main(void)
     assert(p_model_ != NULL);
     assert(nrf_edgeai_is_runtime_compatible(p_model_));
 
-    /** Initialize nRF Edge AI library */
-    nrf_edgeai_err_t res = nrf_edgeai_init(p_model_);
+    /** Initialize nRF Edge AI library with the application window and features interfaces */
+#if CONFIG_EDGEAI_WINDOW_RING_FRAMES > 0
+    nrf_edgeai_err_t res = edgeai_runtime_init(p_model_, model_window_ring_, CONFIG_EDGEAI_WINDOW_RING_FRAMES);
+#else
+    nrf_edgeai_err_t res = edgeai_runtime_init(p_model_, NULL, 0);
+#endif
     assert(res == NRF_EDGEAI_ERR_SUCCESS);
+
+#if CONFIG_EDGEAI_WINDOW_SHIFT > 0
+    /** Latency vs CPU time trade-off, set before the inference thread starts */
+    res = edgeai_runtime_set_window_shift(p_model_, CONFIG_EDGEAI_WINDOW_SHIFT);
+    if (res != NRF_EDGEAI_ERR_SUCCESS)
+    {
+        printk("Failed to set model window shift, error = %d\n", (int)res);
+    }
+#endif
+
+#if CONFIG_EDGEAI_FEATURES_BENCHMARK
+    /** Features extraction cost per window, before the first feed */
+    edgeai_features_benchmark_t benchmark;
+    if (edgeai_benchmark_features(p_model_, FEATURES_BENCHMARK_RUNS, &benchmark) == NRF_EDGEAI_ERR_SUCCESS)
+    {
+        printk("Features extraction cycles per window: library %u, plans %u, bit-exact: %s\r\n",
+               benchmark.library_cycles, benchmark.plans_cycles, benchmark.is_bit_exact ? "yes" : "no");
+        printk("Features not consumed by the model: %u of %u, plans cycles with them %u\r\n",
+               benchmark.pruned_num, benchmark.features_num, benchmark.unpruned_cycles);
+    }
+#endif
+
+#if CONFIG_EDGEAI_INFERENCE_BENCHMARK
+    /** Inference cost and graph size of the model kernels, before the first feed */
+    edgeai_inference_benchmark_t inference_benchmark;
+    if (edgeai_benchmark_inference(p_model_, INFERENCE_BENCHMARK_RUNS, &inference_benchmark) == NRF_EDGEAI_ERR_SUCCESS)
+    {
+        printk("Model inference cycles: library %u, packed %u, unrolled %u, bit-exact: %s\r\n",
+               inference_benchmark.library_cycles, inference_benchmark.packed_cycles,
+               inference_benchmark.unrolled_cycles, inference_benchmark.is_bit_exact ? "yes" : "no");
+        printk("Model graph bytes: library %u, packed %u\r\n",
+               inference_benchmark.library_size, inference_benchmark.packed_size);
+        printk("Sigmoid cycles: library way %u, table %u\r\n",
+               inference_benchmark.sigmoid_ref_cycles, inference_benchmark.sigmoid_lut_cycles);
+    }
+#endif
+
+#ifndef CONFIG_DATA_COLLECTION_MODE
+    /** Complete windows are handed over to the inference thread, so the feed is not blocked by inference */
+    k_sem_init(&model_windows_ready_sem_, 0, 1);
+    k_thread_create(&inference_thread_data_, inference_thread_stack_,
+                    K_THREAD_STACK_SIZEOF(inference_thread_stack_),
+                    inference_thread_, NULL, NULL, NULL,
+                    INFERENCE_THREAD_PRIORITY, 0, K_NO_WAIT);
+    k_thread_name_set(&inference_thread_data_, "inference");
+#endif
     
     nrf_edgeai_rt_version_t version = nrf_edgeai_runtime_version();
 
@@ -128,53 +264,33 @@ int main(void)
     printk("\t nRF Edge AI Runtime Version: %d.%d.%d\r\n", version.field.major, version.field.minor, version.field.patch);
     printk("\t nRF Edge AI Lab Solution id: %s\r\n", nrf_edgeai_solution_id_str(p_model_));
 
-    bsp_imu_data_t imu_data = {0};
-    int16_t input_data[NRF_EDGEAI_INPUT_DATA_LEN];
+    uint32_t reported_overruns = 0;
 
     for (;;)
     {
-        /** Wait for the semaphore to be released by IMU data ready interrupt */
-        k_sem_take(&imu_data_ready_sem_, K_FOREVER);
+        /** Wait for the IMU frames published by the acquisition thread or for free model window storage */
+        k_sem_take(&imu_frames_ready_sem_, K_FOREVER);
 
-        /** Read IMU sensor data sample */
-        if (bsp_imu_read(&imu_data) != BSP_STATUS_SUCCESS)
-            continue;
+        /** Drain everything available, the ring may wrap so it is consumed by contiguous spans */
+        const int16_t* p_frames;
+        uint32_t frames_num;
+        while ((frames_num = imu_ring_read_span(&imu_ring_, &p_frames)) > 0)
+        {
+            const uint16_t span_frames = (uint16_t)MIN(frames_num, UINT16_MAX);
+            const uint16_t fed_frames = process_imu_frames_(p_frames, span_frames);
+            imu_ring_read_release(&imu_ring_, fed_frames);
 
-        input_data[0] = imu_data.accel[0].raw;
-        input_data[1] = imu_data.accel[1].raw;
-        input_data[2] = imu_data.accel[2].raw;
-        input_data[3] = imu_data.gyro[0].raw;
-        input_data[4] = imu_data.gyro[1].raw;
-        input_data[5] = imu_data.gyro[2].raw;
-        /** Feed and prepare raw sensor inputs for the model inference */
-#if CONFIG_DATA_COLLECTION_MODE
-        printk("%d,%d,%d,%d,%d,%d\r\n",  input_data[0], input_data[1], input_data[2], input_data[3], input_data[4], input_data[5]);
-#else        
-        res = nrf_edgeai_feed_inputs(p_model_, input_data, NRF_EDGEAI_INPUT_DATA_LEN);
+            /** Model window storage is full, the rest stays in the ring until the inference slides the windows */
+            if (fed_frames < span_frames)
+                break;
+        }
 
-        /** Check if input data window is ready for inference */
-        if (res == NRF_EDGEAI_ERR_SUCCESS)
+        uint32_t overruns = imu_ring_overruns(&imu_ring_);
+        if (overruns != reported_overruns)
         {
-            /** Run Neuton model inference */
-            res = nrf_edgeai_run_inference(p_model_);
-
-            /** Handle Neuton inference results if the prediction was
-             * successful */
-            if (res == NRF_EDGEAI_ERR_SUCCESS)
-            {
-                /** Predicted class */
-                uint16_t predicted_target = p_model_->decoded_output.classif.predicted_class;
-                /** Probabilities pointer depend on model output quantization setting */
-                const flt32_t* p_probabilities = p_model_->decoded_output.classif.probabilities.p_f32;
-
-                bool do_postprocessing = true;
-                inference_postprocess(predicted_target,
-                                      p_probabilities[predicted_target],
-                                      do_postprocessing,
-                                      model_prediction_handler_);
-            }
+            printk("IMU frames ring overrun, %u frames dropped in total\r\n", overruns);
+            reported_overruns = overruns;
         }
-#endif // CONFIG_DATA_COLLECTION_MODE
     }
 
     return 0;
@@ -206,12 +322,27 @@ static void board_support_init_(void)
     }
     bsp_button_reg_click_handler(button_click_handler_);
 
+    /** Initialize IMU frames ring and acquisition thread */
+    k_sem_init(&imu_data_ready_sem_, 0, 1); // Initial count 0, max count 1
+    k_sem_init(&imu_frames_ready_sem_, 0, 1);
+    imu_ring_init(&imu_ring_, imu_ring_buffer_, NRF_EDGEAI_INPUT_DATA_LEN, CONFIG_IMU_RING_FRAMES);
+#if CONFIG_IMU_DECIMATION_RATIO > 1
+    imu_decimator_init(&imu_decimator_, CONFIG_IMU_DECIMATION_RATIO, NRF_EDGEAI_INPUT_DATA_LEN,
+                       imu_decimator_coeffs_, imu_decimator_history_);
+#endif
+    k_thread_create(&imu_acquisition_thread_data_, imu_acquisition_thread_stack_,
+                    K_THREAD_STACK_SIZEOF(imu_acquisition_thread_stack_),
+                    imu_acquisition_thread_, NULL, NULL, NULL,
+                    IMU_ACQUISITION_THREAD_PRIORITY, 0, K_NO_WAIT);
+    k_thread_name_set(&imu_acquisition_thread_data_, "imu_acq");
+
     /** Initialize IMU sensor  */
     bsp_imu_config_t imu_config = 
     {
         .accel_fs_g = BSP_IMU_ACCEL_SCALE_4G,
         .gyro_fs_dps = BSP_IMU_ACCEL_SCALE_1000DPS,
-        .data_rate_hz = 100
+        .data_rate_hz = IMU_DATA_RATE_HZ,
+        .fifo_watermark_frames = IMU_FIFO_WATERMARK_FRAMES,
     };
 
     bsp_status_t status = bsp_imu_init(&imu_config, imu_data_ready_cb_);
@@ -219,7 +350,6 @@ static void board_support_init_(void)
     {
         printk("Failed to initialize IMU sensor, error = %d\n", (int)status);
     }
-    k_sem_init(&imu_data_ready_sem_, 0, 1); // Initial count 0, max count 1
 
     /** Initialize BLE HID profile */
     ret = ble_hid_init(ble_connection_cb_);
@@ -308,13 +438,258 @@ static void ble_connection_cb_(bool connected)
 
 static void imu_data_ready_cb_(void)
 {
+#if CONFIG_IMU_ASYNC_READ
+    /** Interrupt wakeup may merge with the transfer completion, so it is counted before the give */
+    atomic_inc(&imu_async_pending_);
+#endif
     k_sem_give(&imu_data_ready_sem_); // Release the semaphore
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+static void imu_acquisition_thread_(void* p1, void* p2, void* p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    for (;;)
+    {
+        /** Wait for the semaphore to be released by IMU interrupt */
+        k_sem_take(&imu_data_ready_sem_, K_FOREVER);
+
+#if CONFIG_IMU_ASYNC_READ
+        bool is_fifo_left = false;
+
+        /** Completed transfer is published here, the decimation filter does not run in the interrupt */
+        if (atomic_clear(&imu_async_done_))
+        {
+            const uint16_t frames_num = imu_async_frames_num_;
+
+            if ((frames_num > 0) && (imu_ring_publish_(p_imu_async_frames_, frames_num) > 0))
+            {
+                k_sem_give(&imu_frames_ready_sem_);
+            }
+
+            /** FIFO may hold more frames than the ring span took, it is read again until empty */
+            is_fifo_left = (CONFIG_IMU_FIFO_WATERMARK_FRAMES > 0) && (frames_num > 0);
+        }
+
+        /** Interrupts counted while a transfer was in flight are served after its completion */
+        if (!is_fifo_left && (atomic_get(&imu_async_pending_) == 0))
+            continue;
+
+        int16_t* p_frames;
+        uint16_t max_frames = imu_ring_span_(&p_frames);
+#if CONFIG_BSP_IMU_REPLAY_MAX_SPEED
+        if (max_frames == 0)
+        {
+            imu_replay_wait_ring_();
+            continue;
+        }
+#endif
+
+        /** Bus transfer goes in background, the completion callback wakes the thread,
+         *  a transfer still in flight (BUSY) keeps the interrupts counted */
+        bsp_status_t status = bsp_imu_read_async(p_frames, max_frames, imu_async_read_done_);
+        if (status == BSP_STATUS_SUCCESS)
+        {
+            p_imu_async_frames_ = p_frames;
+
+            /** FIFO burst drains the frames of all counted interrupts, a single sample read serves one */
+            if (CONFIG_IMU_FIFO_WATERMARK_FRAMES > 0)
+                atomic_clear(&imu_async_pending_);
+            else if (atomic_get(&imu_async_pending_) > 0)
+                atomic_dec(&imu_async_pending_);
+        }
+#else
+        uint16_t max_frames;
+        uint16_t frames_num;
+        do
+        {
+            int16_t* p_frames;
+            max_frames = imu_ring_span_(&p_frames);
+#if CONFIG_BSP_IMU_REPLAY_MAX_SPEED
+            if (max_frames == 0)
+            {
+                imu_replay_wait_ring_();
+                break;
+            }
+#endif
+            frames_num = 0;
+            if (imu_read_frames_(p_frames, max_frames, &frames_num) != BSP_STATUS_SUCCESS)
+                break;
+
+            /** Every published span is handed over, the consumer drains it while the next span is read */
+            if (imu_ring_publish_(p_frames, frames_num) > 0)
+            {
+                k_sem_give(&imu_frames_ready_sem_);
+            }
+
+            /** Span at the ring end may be shorter than the batched frames, continue after wrap */
+        } while ((CONFIG_IMU_FIFO_WATERMARK_FRAMES > 0) && (frames_num > 0) && (frames_num == max_frames));
+#endif
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint16_t imu_ring_span_(int16_t** pp_frames)
+{
+    uint32_t free_frames = imu_ring_write_span(&imu_ring_, pp_frames);
+
+#if CONFIG_BSP_IMU_REPLAY_MAX_SPEED
+    /** Unpaced replay has no sensor FIFO to overflow, a full ring is waited for instead of dropping frames */
+    if (free_frames == 0)
+        return 0;
+#endif
+
+    /** Ring is full, the sensor is still drained but frames are dropped */
+    if (free_frames == 0)
+    {
+        *pp_frames = imu_frames_;
+        free_frames = IMU_FRAMES_BUFFER_SIZE;
+    }
+
+    return (uint16_t)MIN(free_frames, IMU_FRAMES_BUFFER_SIZE);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint16_t imu_ring_publish_(int16_t* p_frames, uint16_t frames_num)
+{
+#if CONFIG_IMU_DECIMATION_RATIO > 1
+    /** Oversampled frames are decimated to the model rate in place, dropped frames too to keep the filter state */
+    frames_num = imu_decimator_process(&imu_decimator_, p_frames, frames_num, p_frames);
+#endif
+
+    if (p_frames == imu_frames_)
+        imu_ring_write_overrun(&imu_ring_, frames_num);
+    else
+        imu_ring_write_commit(&imu_ring_, frames_num);
+
+    return frames_num;
+}
+
+#if CONFIG_BSP_IMU_REPLAY_MAX_SPEED
+//////////////////////////////////////////////////////////////////////////////
+
+static void imu_replay_wait_ring_(void)
+{
+    /** Consumers run above the acquisition thread, so they drain the ring before the read is retried,
+     *  data ready is raised again as no replay read was made to signal the next batch */
+    k_sem_give(&imu_frames_ready_sem_);
+    imu_data_ready_cb_();
+}
+#endif
+
+#if CONFIG_IMU_ASYNC_READ
+//////////////////////////////////////////////////////////////////////////////
+
+static void imu_async_read_done_(void* data, uint32_t data_size)
+{
+    ARG_UNUSED(data);
+
+    /** Interrupt context, only the frames number is recorded */
+    imu_async_frames_num_ = data_size / (NRF_EDGEAI_INPUT_DATA_LEN * sizeof(int16_t));
+    atomic_set(&imu_async_done_, 1);
+
+    k_sem_give(&imu_data_ready_sem_);
+}
+#endif
+
+#if !CONFIG_IMU_ASYNC_READ
+//////////////////////////////////////////////////////////////////////////////
+
+static bsp_status_t imu_read_frames_(int16_t* p_frames, uint16_t max_frames, uint16_t* p_frames_num)
+{
+#if CONFIG_IMU_FIFO_WATERMARK_FRAMES > 0
+    /** Drain IMU frames batched in the sensor FIFO with a single burst read */
+    return bsp_imu_fifo_read(p_frames, max_frames, p_frames_num);
+#else
+    ARG_UNUSED(max_frames);
+
+    /** Read IMU sensor data sample straight into the ring slot in model units */
+    bsp_status_t status = bsp_imu_read_frame(p_frames);
+    BSP_VERIFY_SUCCESS(status);
+
+    *p_frames_num = 1;
+
+    return BSP_STATUS_SUCCESS;
+#endif
+}
+#endif // !CONFIG_IMU_ASYNC_READ
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint16_t process_imu_frames_(const int16_t* p_frames, uint16_t frames_num)
+{
+#if CONFIG_DATA_COLLECTION_MODE
+    for (uint16_t i = 0; i < frames_num; i++)
+    {
+        const int16_t* p_frame = &p_frames[i * NRF_EDGEAI_INPUT_DATA_LEN];
+        printk("%d,%d,%d,%d,%d,%d\r\n",  p_frame[0], p_frame[1], p_frame[2], p_frame[3], p_frame[4], p_frame[5]);
+    }
+
+    return frames_num;
+#else
+    /** Feed the whole block, it is taken as far as the model window storage holds */
+    uint16_t fed_num;
+    if (edgeai_runtime_feed(p_model_, p_frames, frames_num, &fed_num) > 0)
+    {
+        /** Complete windows are handed over to the inference thread */
+        k_sem_give(&model_windows_ready_sem_);
+    }
+
+    return fed_num;
+#endif // CONFIG_DATA_COLLECTION_MODE
+}
+
 //////////////////////////////////////////////////////////////////////////////
 #ifndef CONFIG_DATA_COLLECTION_MODE
+static void inference_thread_(void* p1, void* p2, void* p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    for (;;)
+    {
+        /** Wait for the complete windows handed over by the feed */
+        k_sem_take(&model_windows_ready_sem_, K_FOREVER);
+
+        /** Run Neuton model inference of the complete windows back-to-back */
+        edgeai_runtime_run_windows(p_model_, model_output_handler_);
+
+        /** Window storage is free again, frames left in the IMU ring can be fed */
+        k_sem_give(&imu_frames_ready_sem_);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void model_output_handler_(nrf_edgeai_t* p_edgeai)
+{
+    /** Predicted class */
+    uint16_t predicted_target = p_edgeai->decoded_output.classif.predicted_class;
+    /** Probabilities pointer depend on model output quantization setting */
+#if CONFIG_EDGEAI_FIXED_POINT_OUTPUT
+    const uint16_t* p_probabilities = p_edgeai->decoded_output.classif.probabilities.p_q16;
+#else
+    const flt32_t* p_probabilities = p_edgeai->decoded_output.classif.probabilities.p_f32;
+#endif
+
+    bool do_postprocessing = true;
+    inference_postprocess(predicted_target,
+                          p_probabilities[predicted_target],
+                          do_postprocessing,
+                          model_prediction_handler_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 static void model_prediction_handler_(const class_label_t class_label, 
-                                        const float probability,
+                                        const inference_probability_t probability,
                                         const char* class_name,
                                         const bool is_raw)
 {
@@ -322,7 +697,7 @@ static void model_prediction_handler_(const class_label_t class_label,
 
     if (is_raw)
     {
-        printk("RAW Prediction %s %d %%\r\n", class_name, (int8_t)(probability * 100.0f));
+        printk("RAW Prediction %s %d %%\r\n", class_name, (int8_t)inference_probability_percent(probability));
     }
     else if (class_label > CLASS_LABEL_UNKNOWN)
     {
@@ -338,7 +713,7 @@ static void model_prediction_handler_(const class_label_t class_label,
         {
             last_prediction_time_ms_ = current_time_ms;
 
-            printk("Predicted class: %s, with probability %d %%\r\n", class_name, (int)(100 * probability));
+            printk("Predicted class: %s, with probability %d %%\r\n", class_name, inference_probability_percent(probability));
 
             send_bt_keyboard_key_(class_label);
         }
@@ -0,0 +1,23 @@
+#ifndef HOST_STUB_CMDLINE_H__
+#define HOST_STUB_CMDLINE_H__
+
+#include <zephyr/types.h>
+
+/** native_sim command line options, the host tests take the defaults */
+struct args_struct_t
+{
+    const char* option;
+    const char* name;
+    char type;
+    void* dest;
+    const char* descript;
+};
+
+#define ARG_TABLE_ENDMARKER { NULL, NULL, 0, NULL, NULL }
+
+static inline void native_add_command_line_opts(struct args_struct_t* args)
+{
+    (void)args;
+}
+
+#endif /* HOST_STUB_CMDLINE_H__ */
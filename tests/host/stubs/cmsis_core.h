@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef CMSIS_CORE_H__
+#define CMSIS_CORE_H__
+
+#include <stdint.h>
+
+/**
+ * Host equivalents of the Armv8-M DSP intrinsics used by the application, lane by lane.
+ * Intrinsics depending on the APSR.GE flags are not provided.
+ */
+
+static inline int32_t cmsis_lane_(uint32_t x, uint8_t lane)
+{
+    return (int16_t)(x >> (16 * lane));
+}
+
+static inline uint32_t __UADD16(uint32_t a, uint32_t b)
+{
+    return ((a + b) & 0xFFFFU) | (((a >> 16) + (b >> 16)) << 16);
+}
+
+static inline uint32_t __SMLAD(uint32_t a, uint32_t b, uint32_t acc)
+{
+    return acc + (uint32_t)(cmsis_lane_(a, 0) * cmsis_lane_(b, 0)) + (uint32_t)(cmsis_lane_(a, 1) * cmsis_lane_(b, 1));
+}
+
+static inline uint64_t __SMLALD(uint32_t a, uint32_t b, uint64_t acc)
+{
+    return acc + (uint64_t)((int64_t)cmsis_lane_(a, 0) * cmsis_lane_(b, 0) + (int64_t)cmsis_lane_(a, 1) * cmsis_lane_(b, 1));
+}
+
+#endif /* CMSIS_CORE_H__ */
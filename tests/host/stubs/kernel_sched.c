@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+// ///////////////////////// Package Header Files ////////////////////////////
+#include <zephyr/kernel.h>
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <assert.h>
+#include <errno.h>
+
+/**
+ * Host threads of the Zephyr threads, run one at a time. The running thread passes the CPU
+ * to the highest priority ready thread when it blocks on a semaphore, or when it is preemptible
+ * and a semaphore give or a thread creation readies a higher priority thread. The threads
+ * of the same priority run in the order they became ready. Deterministic, unlike free running
+ * host threads, so the tests see the interleaving of the target.
+ */
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define SCHED_THREADS_MAX  (8)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t idle_cond;
+    struct k_thread* p_threads[SCHED_THREADS_MAX];
+    uint16_t threads_num;
+    struct k_thread* p_current;
+    uint64_t ready_seq;
+    bool is_idle;
+} sched_ = { .lock = PTHREAD_MUTEX_INITIALIZER, .idle_cond = PTHREAD_COND_INITIALIZER };
+
+static struct k_thread host_main_thread_;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void make_ready_(struct k_thread* p_thread)
+{
+    p_thread->is_ready = true;
+    p_thread->ready_seq = ++sched_.ready_seq;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static bool is_before_(const struct k_thread* p_a, const struct k_thread* p_b)
+{
+    return (p_a->prio < p_b->prio) || ((p_a->prio == p_b->prio) && (p_a->ready_seq < p_b->ready_seq));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void schedule_(void)
+{
+    struct k_thread* p_next = NULL;
+
+    for (uint16_t i = 0; i < sched_.threads_num; i++)
+    {
+        struct k_thread* p_thread = sched_.p_threads[i];
+        if (p_thread->is_ready && ((p_next == NULL) || is_before_(p_thread, p_next)))
+            p_next = p_thread;
+    }
+
+    sched_.p_current = p_next;
+
+    if (p_next != NULL)
+    {
+        pthread_cond_signal(&p_next->cond);
+    }
+    else
+    {
+        sched_.is_idle = true;
+        pthread_cond_signal(&sched_.idle_cond);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void wait_turn_(struct k_thread* p_self)
+{
+    while (sched_.p_current != p_self)
+        pthread_cond_wait(&p_self->cond, &sched_.lock);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void preempt_(struct k_thread* p_readied)
+{
+    struct k_thread* p_self = sched_.p_current;
+
+    /** Cooperative threads, negative priorities, run until they block */
+    if ((p_self == NULL) || (p_self->prio < 0) || (p_readied->prio >= p_self->prio))
+        return;
+
+    make_ready_(p_self);
+    schedule_();
+    wait_turn_(p_self);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void* thread_main_(void* p_arg)
+{
+    struct k_thread* p_self = p_arg;
+
+    pthread_mutex_lock(&sched_.lock);
+    wait_turn_(p_self);
+    pthread_mutex_unlock(&sched_.lock);
+
+    p_self->entry(p_self->p1, p_self->p2, p_self->p3);
+
+    pthread_mutex_lock(&sched_.lock);
+    p_self->is_ready = false;
+    schedule_();
+    pthread_mutex_unlock(&sched_.lock);
+
+    return NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void thread_start_(struct k_thread* p_thread, k_thread_entry_t entry,
+                          void* p1, void* p2, void* p3, int prio)
+{
+    assert(sched_.threads_num < SCHED_THREADS_MAX);
+
+    p_thread->entry = entry;
+    p_thread->p1 = p1;
+    p_thread->p2 = p2;
+    p_thread->p3 = p3;
+    p_thread->prio = prio;
+    p_thread->p_sem = NULL;
+    pthread_cond_init(&p_thread->cond, NULL);
+
+    sched_.p_threads[sched_.threads_num++] = p_thread;
+    make_ready_(p_thread);
+
+    pthread_create(&p_thread->pthread, NULL, thread_main_, p_thread);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+k_tid_t k_thread_create(struct k_thread* new_thread, k_thread_stack_t* stack, size_t stack_size,
+                        k_thread_entry_t entry, void* p1, void* p2, void* p3,
+                        int prio, uint32_t options, k_timeout_t delay)
+{
+    (void)stack;
+    (void)stack_size;
+    (void)options;
+    (void)delay;
+
+    pthread_mutex_lock(&sched_.lock);
+    thread_start_(new_thread, entry, p1, p2, p3, prio);
+    preempt_(new_thread);
+    pthread_mutex_unlock(&sched_.lock);
+
+    return new_thread;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int k_thread_name_set(k_tid_t thread, const char* name)
+{
+    (void)thread;
+    (void)name;
+
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void k_sem_init(struct k_sem* sem, unsigned int initial_count, unsigned int limit)
+{
+    sem->count = initial_count;
+    sem->limit = limit;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int k_sem_take(struct k_sem* sem, k_timeout_t timeout)
+{
+    int res = 0;
+
+    pthread_mutex_lock(&sched_.lock);
+
+    if (sem->count > 0)
+    {
+        sem->count--;
+    }
+    else if (timeout.ticks == 0)
+    {
+        res = -EBUSY;
+    }
+    else
+    {
+        /** Timeouts never expire on the host, the giver hands the count over to the waiter */
+        struct k_thread* p_self = sched_.p_current;
+        p_self->is_ready = false;
+        p_self->p_sem = sem;
+        schedule_();
+        wait_turn_(p_self);
+    }
+
+    pthread_mutex_unlock(&sched_.lock);
+
+    return res;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void k_sem_give(struct k_sem* sem)
+{
+    pthread_mutex_lock(&sched_.lock);
+
+    struct k_thread* p_waiter = NULL;
+    for (uint16_t i = 0; i < sched_.threads_num; i++)
+    {
+        struct k_thread* p_thread = sched_.p_threads[i];
+        if ((p_thread->p_sem == sem) && ((p_waiter == NULL) || is_before_(p_thread, p_waiter)))
+            p_waiter = p_thread;
+    }
+
+    if (p_waiter != NULL)
+    {
+        p_waiter->p_sem = NULL;
+        make_ready_(p_waiter);
+        preempt_(p_waiter);
+    }
+    else if (sem->count < sem->limit)
+    {
+        sem->count++;
+    }
+
+    pthread_mutex_unlock(&sched_.lock);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void k_host_run_until_idle(k_thread_entry_t entry, int prio)
+{
+    pthread_mutex_lock(&sched_.lock);
+
+    sched_.is_idle = false;
+    thread_start_(&host_main_thread_, entry, NULL, NULL, NULL, prio);
+    schedule_();
+
+    while (!sched_.is_idle)
+        pthread_cond_wait(&sched_.idle_cond, &sched_.lock);
+
+    pthread_mutex_unlock(&sched_.lock);
+}
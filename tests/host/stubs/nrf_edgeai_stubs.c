@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+// ///////////////////////// Package Header Files ////////////////////////////
+#include <nrf_edgeai/rt/private/nrf_edgeai_interfaces.h>
+#include <nrf_edgeai/rt/private/features/dsp/nrf_edgeai_features_timedomain.h>
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <stdlib.h>
+
+/**
+ * nRF Edge AI library is built for Arm only. Its functions referenced by the generated model
+ * and the feature plans are defined here so that the host tests link, the tests never call them.
+ */
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define LIBRARY_STUB(declaration) declaration { abort(); }
+
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_FEATURE_FUNCTION_I16(utility_tss_sum_i16))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_FEATURE_FUNCTION_I16(min_max_range_i16))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_FEATURE_FUNCTION_I16(min_i16))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_FEATURE_FUNCTION_I16(max_i16))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_FEATURE_FUNCTION_I16(mean_i16))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_FEATURE_FUNCTION_I16(mad_i16))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_FEATURE_FUNCTION_I16(std_i16))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_FEATURE_FUNCTION_I16(rms_i16))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_FEATURE_FUNCTION_I16(mcr_i16))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_FEATURE_FUNCTION_I16(zcr_i16))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_FEATURE_FUNCTION_I16(absmean_i16))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_FEATURE_FUNCTION_I16(amdf_i16))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_FEATURE_FUNCTION_I16(psoz_i16))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_FEATURE_FUNCTION_I16(rmds_i16))
+
+LIBRARY_STUB(nrf_edgeai_err_t nrf_edgeai_input_setup_sliding_window(nrf_edgeai_input_t* p_input_ctx))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_INPUT_FEED_INTERFACE(sliding_window_i16))
+LIBRARY_STUB(NRF_EDGEAI_DECLARE_PROCESS_FEATURES_INTERFACE(dsp_i16_q16))
+LIBRARY_STUB(void nrf_edgeai_output_dequantize_q16_f32(nrf_edgeai_model_t* p_model))
+LIBRARY_STUB(void nrf_edgeai_output_decode_classification_f32(nrf_edgeai_model_output_t* p_model_output,
+                                                             nrf_edgeai_decoded_output_t* p_decoded_output))
@@ -0,0 +1,23 @@
+#ifndef HOST_STUB_NSI_HOST_TRAMPOLINES_H__
+#define HOST_STUB_NSI_HOST_TRAMPOLINES_H__
+
+#include <fcntl.h>
+#include <unistd.h>
+
+/** native_sim host calls are the host calls themselves */
+static inline int nsi_host_open(const char* pathname, int flags)
+{
+    return open(pathname, flags);
+}
+
+static inline long nsi_host_read(int fd, void* buffer, unsigned long size)
+{
+    return read(fd, buffer, size);
+}
+
+static inline int nsi_host_close(int fd)
+{
+    return close(fd);
+}
+
+#endif /* HOST_STUB_NSI_HOST_TRAMPOLINES_H__ */
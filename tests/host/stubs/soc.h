@@ -0,0 +1,8 @@
+#ifndef HOST_STUB_SOC_H__
+#define HOST_STUB_SOC_H__
+
+/** native_sim tasks of the host test run before the test main() */
+#define NATIVE_TASK(fn, level, prio) \
+    __attribute__((constructor)) static void native_task_##fn##_(void) { fn(); }
+
+#endif /* HOST_STUB_SOC_H__ */
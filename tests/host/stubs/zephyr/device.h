@@ -0,0 +1,11 @@
+#ifndef ZEPHYR_HOST_STUB_DEVICE_H__
+#define ZEPHYR_HOST_STUB_DEVICE_H__
+
+#include <zephyr/types.h>
+
+struct device
+{
+    const char* name;
+};
+
+#endif /* ZEPHYR_HOST_STUB_DEVICE_H__ */
@@ -0,0 +1,21 @@
+#ifndef ZEPHYR_HOST_STUB_DRIVERS_SENSOR_H__
+#define ZEPHYR_HOST_STUB_DRIVERS_SENSOR_H__
+
+#include <zephyr/device.h>
+
+/** Same constants and conversion as the Zephyr sensor API */
+#define SENSOR_G    9806650LL
+#define SENSOR_PI   3141592LL
+
+struct sensor_value
+{
+    int32_t val1;
+    int32_t val2;
+};
+
+static inline double sensor_value_to_double(const struct sensor_value* val)
+{
+    return (double)val->val1 + (double)val->val2 / 1000000;
+}
+
+#endif /* ZEPHYR_HOST_STUB_DRIVERS_SENSOR_H__ */
@@ -0,0 +1,128 @@
+#ifndef ZEPHYR_HOST_STUB_KERNEL_H__
+#define ZEPHYR_HOST_STUB_KERNEL_H__
+
+#include <pthread.h>
+
+#include <zephyr/types.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/printk.h>
+
+typedef struct { int64_t ticks; } k_timeout_t;
+
+#define K_NO_WAIT   ((k_timeout_t){ 0 })
+#define K_FOREVER   ((k_timeout_t){ -1 })
+#define K_USEC(t)   ((k_timeout_t){ (t) })
+#define K_NSEC(t)   ((k_timeout_t){ (t) / 1000 })
+#define K_MSEC(t)   ((k_timeout_t){ (t) * 1000 })
+
+/** Timers never expire on the host, tests drive the code directly */
+struct k_timer
+{
+    void (*expiry_fn)(struct k_timer* timer);
+    void (*stop_fn)(struct k_timer* timer);
+};
+
+#define K_TIMER_DEFINE(name, expiry, stop) struct k_timer name = { expiry, stop }
+
+static inline void k_timer_start(struct k_timer* timer, k_timeout_t duration, k_timeout_t period)
+{
+    (void)timer;
+    (void)duration;
+    (void)period;
+}
+
+static inline void k_timer_stop(struct k_timer* timer)
+{
+    (void)timer;
+}
+
+static inline int64_t k_uptime_ticks(void)
+{
+    return 0;
+}
+
+static inline int64_t k_uptime_get(void)
+{
+    return 0;
+}
+
+static inline uint64_t k_ticks_to_us_floor64(uint64_t ticks)
+{
+    return ticks;
+}
+
+/** Work items are never run on the host, there is no system work queue */
+struct k_work
+{
+    void (*handler)(struct k_work* work);
+};
+
+static inline void k_work_init(struct k_work* work, void (*handler)(struct k_work* work))
+{
+    work->handler = handler;
+}
+
+static inline int k_work_submit(struct k_work* work)
+{
+    (void)work;
+    return 0;
+}
+
+/**
+ * Threads and semaphores of kernel_sched.c: host threads run one at a time by the Zephyr
+ * scheduling rules, the highest priority ready thread runs and a preemptible thread is
+ * preempted as soon as a higher priority thread becomes ready.
+ */
+#define CONFIG_NUM_COOP_PRIORITIES  (16)
+#define K_PRIO_COOP(x)              (-(CONFIG_NUM_COOP_PRIORITIES - (x)))
+#define K_PRIO_PREEMPT(x)           (x)
+
+typedef void (*k_thread_entry_t)(void* p1, void* p2, void* p3);
+typedef char k_thread_stack_t;
+
+#define K_THREAD_STACK_DEFINE(sym, size)    k_thread_stack_t sym[size]
+#define K_THREAD_STACK_SIZEOF(sym)          sizeof(sym)
+
+struct k_sem
+{
+    unsigned int count;
+    unsigned int limit;
+};
+
+struct k_thread
+{
+    pthread_t pthread;
+    pthread_cond_t cond;
+    k_thread_entry_t entry;
+    void* p1;
+    void* p2;
+    void* p3;
+    int prio;
+    bool is_ready;
+    /** Ready order of the threads of the same priority */
+    uint64_t ready_seq;
+    /** Semaphore the thread waits on */
+    struct k_sem* p_sem;
+};
+
+typedef struct k_thread* k_tid_t;
+
+k_tid_t k_thread_create(struct k_thread* new_thread, k_thread_stack_t* stack, size_t stack_size,
+                        k_thread_entry_t entry, void* p1, void* p2, void* p3,
+                        int prio, uint32_t options, k_timeout_t delay);
+
+int k_thread_name_set(k_tid_t thread, const char* name);
+
+void k_sem_init(struct k_sem* sem, unsigned int initial_count, unsigned int limit);
+
+int k_sem_take(struct k_sem* sem, k_timeout_t timeout);
+
+void k_sem_give(struct k_sem* sem);
+
+/**
+ * Start the first thread, e.g. the application main(), and wait until all threads are blocked.
+ * Host test helper, not a Zephyr API.
+ */
+void k_host_run_until_idle(k_thread_entry_t entry, int prio);
+
+#endif /* ZEPHYR_HOST_STUB_KERNEL_H__ */
@@ -0,0 +1,6 @@
+#ifndef ZEPHYR_HOST_STUB_LOGGING_LOG_H__
+#define ZEPHYR_HOST_STUB_LOGGING_LOG_H__
+
+#define LOG_MODULE_REGISTER(name)
+
+#endif /* ZEPHYR_HOST_STUB_LOGGING_LOG_H__ */
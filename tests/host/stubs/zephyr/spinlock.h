@@ -0,0 +1,24 @@
+#ifndef ZEPHYR_HOST_STUB_SPINLOCK_H__
+#define ZEPHYR_HOST_STUB_SPINLOCK_H__
+
+/** Host tests are single threaded */
+struct k_spinlock
+{
+    int locked;
+};
+
+typedef int k_spinlock_key_t;
+
+static inline k_spinlock_key_t k_spin_lock(struct k_spinlock* lock)
+{
+    lock->locked = 1;
+    return 0;
+}
+
+static inline void k_spin_unlock(struct k_spinlock* lock, k_spinlock_key_t key)
+{
+    (void)key;
+    lock->locked = 0;
+}
+
+#endif /* ZEPHYR_HOST_STUB_SPINLOCK_H__ */
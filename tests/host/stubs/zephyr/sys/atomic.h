@@ -0,0 +1,51 @@
+#ifndef ZEPHYR_HOST_STUB_SYS_ATOMIC_H__
+#define ZEPHYR_HOST_STUB_SYS_ATOMIC_H__
+
+#include <zephyr/types.h>
+
+typedef long atomic_t;
+typedef long atomic_val_t;
+
+#define ATOMIC_INIT(i) (i)
+
+static inline atomic_val_t atomic_get(const atomic_t* target)
+{
+    return __atomic_load_n(target, __ATOMIC_SEQ_CST);
+}
+
+static inline atomic_val_t atomic_set(atomic_t* target, atomic_val_t value)
+{
+    return __atomic_exchange_n(target, value, __ATOMIC_SEQ_CST);
+}
+
+static inline atomic_val_t atomic_clear(atomic_t* target)
+{
+    return atomic_set(target, 0);
+}
+
+static inline atomic_val_t atomic_add(atomic_t* target, atomic_val_t value)
+{
+    return __atomic_fetch_add(target, value, __ATOMIC_SEQ_CST);
+}
+
+static inline atomic_val_t atomic_sub(atomic_t* target, atomic_val_t value)
+{
+    return __atomic_fetch_sub(target, value, __ATOMIC_SEQ_CST);
+}
+
+static inline atomic_val_t atomic_inc(atomic_t* target)
+{
+    return atomic_add(target, 1);
+}
+
+static inline atomic_val_t atomic_dec(atomic_t* target)
+{
+    return atomic_sub(target, 1);
+}
+
+static inline bool atomic_cas(atomic_t* target, atomic_val_t old_value, atomic_val_t new_value)
+{
+    return __atomic_compare_exchange_n(target, &old_value, new_value, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+#endif /* ZEPHYR_HOST_STUB_SYS_ATOMIC_H__ */
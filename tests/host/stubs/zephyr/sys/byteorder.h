@@ -0,0 +1,17 @@
+#ifndef ZEPHYR_HOST_STUB_SYS_BYTEORDER_H__
+#define ZEPHYR_HOST_STUB_SYS_BYTEORDER_H__
+
+#include <zephyr/types.h>
+
+static inline uint16_t sys_get_le16(const uint8_t src[2])
+{
+    return (uint16_t)(src[0] | (src[1] << 8));
+}
+
+static inline void sys_put_le16(uint16_t val, uint8_t dst[2])
+{
+    dst[0] = (uint8_t)val;
+    dst[1] = (uint8_t)(val >> 8);
+}
+
+#endif /* ZEPHYR_HOST_STUB_SYS_BYTEORDER_H__ */
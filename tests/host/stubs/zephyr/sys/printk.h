@@ -0,0 +1,8 @@
+#ifndef ZEPHYR_HOST_STUB_SYS_PRINTK_H__
+#define ZEPHYR_HOST_STUB_SYS_PRINTK_H__
+
+#include <stdio.h>
+
+#define printk printf
+
+#endif /* ZEPHYR_HOST_STUB_SYS_PRINTK_H__ */
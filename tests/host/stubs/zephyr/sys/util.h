@@ -0,0 +1,24 @@
+#ifndef ZEPHYR_HOST_STUB_SYS_UTIL_H__
+#define ZEPHYR_HOST_STUB_SYS_UTIL_H__
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+#define CLAMP(val, low, high) (((val) <= (low)) ? (low) : MIN(val, high))
+
+#define ARG_UNUSED(x) (void)(x)
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+#define BIT(n) (1UL << (n))
+#define IS_POWER_OF_TWO(x) (((x) != 0U) && (((x) & ((x) - 1U)) == 0U))
+
+/** IS_ENABLED() of Zephyr, true if the option is defined to 1 */
+#define Z_IS_ENABLED_PLACEHOLDER_1 ~,
+#define Z_IS_ENABLED_3(ignore_this, val, ...) val
+#define Z_IS_ENABLED_2(one_or_two_args) Z_IS_ENABLED_3(one_or_two_args 1, 0)
+#define Z_IS_ENABLED_1(config_macro) Z_IS_ENABLED_2(Z_IS_ENABLED_PLACEHOLDER_##config_macro)
+#define IS_ENABLED(config_macro) Z_IS_ENABLED_1(config_macro)
+
+#endif /* ZEPHYR_HOST_STUB_SYS_UTIL_H__ */
@@ -0,0 +1,15 @@
+/**
+ * Minimal Zephyr API subset for building application modules as host tests
+ */
+#ifndef ZEPHYR_HOST_STUB_TYPES_H__
+#define ZEPHYR_HOST_STUB_TYPES_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include <zephyr/sys/util.h>
+
+#define BUILD_ASSERT(cond, msg) _Static_assert(cond, msg)
+
+#endif /* ZEPHYR_HOST_STUB_TYPES_H__ */
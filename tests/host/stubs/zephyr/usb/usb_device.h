@@ -0,0 +1,7 @@
+#ifndef ZEPHYR_HOST_STUB_USB_DEVICE_H__
+#define ZEPHYR_HOST_STUB_USB_DEVICE_H__
+
+/** Logging comes with the USB device API, as in Zephyr */
+#include <zephyr/logging/log.h>
+
+#endif /* ZEPHYR_HOST_STUB_USB_DEVICE_H__ */
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+// ///////////////////////// Package Header Files ////////////////////////////
+#include <sensor/imu/bsp_imu.h>
+#include <zephyr/drivers/sensor.h>
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <stdio.h>
+
+/**
+ * Integer conversion of sensor register counts to model units is compared with the float path
+ * of the sensor driver and bsp_imu_read() for every register value in every full-scale range.
+ */
+
+//////////////////////////////////////////////////////////////////////////////
+
+static const int32_t ACCEL_RANGES_G[] = { 2, 4, 8, 16 };
+static const int32_t GYRO_RANGES_DPS[] = { 125, 250, 500, 1000, 2000 };
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Float path: sensor driver micro units, sensor_value_to_double(), float model units truncated to int16 */
+static int16_t reference_raw_(int64_t micro)
+{
+    const struct sensor_value value =
+    {
+        .val1 = (int32_t)(micro / 1000000),
+        .val2 = (int32_t)(micro % 1000000),
+    };
+    const float phys = (float)sensor_value_to_double(&value);
+
+    return (int16_t)(phys * 1000);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t range_check_(const char* p_name, int32_t range, int16_t (*lsb_to_raw)(int16_t), int64_t micro_per_lsb_num, int64_t micro_per_lsb_den)
+{
+    uint32_t errors_num = 0;
+
+    for (int32_t lsb = INT16_MIN; lsb <= INT16_MAX; lsb++)
+    {
+        /** Same integer micro units as the Zephyr BMI270 driver */
+        const int64_t micro = (lsb * micro_per_lsb_num) / micro_per_lsb_den;
+        const int16_t expected = reference_raw_(micro);
+        const int16_t raw = lsb_to_raw((int16_t)lsb);
+
+        if (raw != expected)
+        {
+            if (errors_num < 8)
+                printf("%s range %d: lsb %d raw %d expected %d\n", p_name, range, lsb, raw, expected);
+            errors_num++;
+        }
+    }
+
+    return errors_num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int main(void)
+{
+    uint32_t errors_num = 0;
+
+    for (size_t i = 0; i < ARRAY_SIZE(GYRO_RANGES_DPS); i++)
+    {
+        /** Accelerometer and gyroscope ranges are initialized in pairs, the last accelerometer range repeats */
+        const bsp_imu_config_t config =
+        {
+            .accel_fs_g = ACCEL_RANGES_G[MIN(i, ARRAY_SIZE(ACCEL_RANGES_G) - 1)],
+            .gyro_fs_dps = GYRO_RANGES_DPS[i],
+            .data_rate_hz = 100,
+        };
+
+        if (bsp_imu_init(&config, NULL) != BSP_STATUS_SUCCESS)
+        {
+            printf("bsp_imu_init failed\n");
+            return 1;
+        }
+
+        if (i < ARRAY_SIZE(ACCEL_RANGES_G))
+            errors_num += range_check_("accel", config.accel_fs_g, bsp_imu_accel_lsb_to_raw,
+                                       SENSOR_G * config.accel_fs_g, INT16_MAX);
+
+        errors_num += range_check_("gyro", config.gyro_fs_dps, bsp_imu_gyro_lsb_to_raw,
+                                   config.gyro_fs_dps * SENSOR_PI, 180LL * INT16_MAX);
+    }
+
+    printf("bsp_imu lsb to raw: %u mismatches in %u ranges of 65536 values\n",
+           errors_num, (unsigned)(ARRAY_SIZE(ACCEL_RANGES_G) + ARRAY_SIZE(GYRO_RANGES_DPS)));
+
+    return (errors_num == 0) ? 0 : 1;
+}
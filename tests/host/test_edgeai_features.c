@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_features.h"
+#include <nrf_edgeai/rt/private/features/dsp/nrf_edgeai_features_timedomain.h>
+#include <zephyr/sys/util.h>
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Span features extraction of the selected backend is compared with a sample by sample
+ * transcription of the library feature functions over the linear window. Spans wrap at
+ * every position and start at odd samples, on random and full-scale edge-case vectors,
+ * so the pair passes of the DSP backend see unaligned pairs, odd tails and saturating lanes.
+ */
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define SPAN_LEN_MAX    (300)
+#define CASES_NUM       (200000)
+#define PATTERNS_NUM    (8)
+
+/** Pipeline functions of the library in the generated model order */
+#define LIBRARY_FUNCS_NUM (ARRAY_SIZE(LIBRARY_FUNCS_))
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Library functions are referenced by the plans only, the extraction never calls their host stubs */
+static const nrf_edgeai_features_pipeline_func_i16_t LIBRARY_FUNCS_[] =
+{
+    nrf_edgeai_feature_utility_tss_sum_i16,
+    nrf_edgeai_feature_min_max_range_i16,
+    nrf_edgeai_feature_min_i16,
+    nrf_edgeai_feature_max_i16,
+    nrf_edgeai_feature_mean_i16,
+    nrf_edgeai_feature_mad_i16,
+    nrf_edgeai_feature_std_i16,
+    nrf_edgeai_feature_rms_i16,
+    nrf_edgeai_feature_mcr_i16,
+    nrf_edgeai_feature_zcr_i16,
+    nrf_edgeai_feature_absmean_i16,
+    nrf_edgeai_feature_amdf_i16,
+    nrf_edgeai_feature_psoz_i16,
+    nrf_edgeai_feature_rmds_i16,
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int16_t linear_[SPAN_LEN_MAX];
+static int16_t ring_[SPAN_LEN_MAX + 1];
+static uint32_t random_state_ = 12345;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t random_(void)
+{
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+
+    return random_state_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int16_t pattern_sample_(uint8_t pattern, uint16_t i)
+{
+    switch (pattern)
+    {
+        case 0:
+            return (int16_t)random_();
+        case 1:
+            return (int16_t)(random_() % 201) - 100;
+        case 2:
+            return (random_() & 1) ? INT16_MAX : INT16_MIN;
+        case 3:
+            return (i & 1) ? INT16_MAX : INT16_MIN;
+        case 4:
+            return INT16_MIN;
+        case 5:
+            return INT16_MAX;
+        case 6:
+            return 0;
+        default:
+            return (int16_t)((random_() % 3) - 1);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t reference_sqrt_(uint32_t x)
+{
+    if (x == 0)
+        return 0;
+
+    uint32_t guess;
+    if (x >> 16)
+        guess = (x & 0xFF000000U) ? 16383 : 1023;
+    else if (x & 0xFF00U)
+        guess = 63;
+    else
+        guess = (x < 5) ? x : 7;
+
+    uint32_t root = x;
+    for (;;)
+    {
+        guess = guess + x / guess;
+        guess = (guess >> 1) + (guess & 1);
+        if (root > guess)
+            root = guess;
+        else
+            break;
+    }
+
+    return root;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int16_t reference_crossing_rate_(uint32_t crossings, uint16_t num)
+{
+    /** Counter wraps as the library int16 counter */
+    const uint32_t pairs = (uint32_t)num - 1;
+
+    return (pairs > 0) ? (int16_t)((uint32_t)((int32_t)(int16_t)crossings * 1000) / pairs) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Features of the library function func of the pipeline, sample by sample as the library computes them */
+static uint16_t reference_func_(uint8_t func, const int16_t* p_data, uint16_t num, uint32_t mask, int32_t* p_out)
+{
+    int32_t sum = 0;
+    uint64_t tss = 0;
+    for (uint16_t i = 0; i < num; i++)
+    {
+        sum += p_data[i];
+        tss += (uint64_t)((int32_t)p_data[i] * p_data[i]);
+    }
+    const int16_t mean = (int16_t)(sum / (int32_t)num);
+    uint16_t out_num = 0;
+
+    switch (func)
+    {
+        case 0:
+            break;
+
+        case 1:
+        {
+            int16_t min = p_data[0];
+            int16_t max = INT16_MIN;
+            for (uint16_t i = 0; i < num; i++)
+            {
+                min = MIN(min, p_data[i]);
+                max = MAX(max, p_data[i]);
+            }
+            if (mask & NRF_EDGEAI_FEATURE_BIT_MIN)
+                p_out[out_num++] = min;
+            if (mask & NRF_EDGEAI_FEATURE_BIT_MAX)
+                p_out[out_num++] = max;
+            if (mask & NRF_EDGEAI_FEATURE_BIT_RANGE)
+                p_out[out_num++] = max - min;
+            break;
+        }
+
+        case 2:
+        case 3:
+        {
+            const bool is_min = (func == 2);
+            if ((mask & (is_min ? NRF_EDGEAI_FEATURE_BIT_MIN : NRF_EDGEAI_FEATURE_BIT_MAX)) == 0)
+                break;
+            int16_t value = is_min ? INT16_MAX : INT16_MIN;
+            for (uint16_t i = 0; i < num; i++)
+                value = is_min ? MIN(value, p_data[i]) : MAX(value, p_data[i]);
+            p_out[out_num++] = value;
+            break;
+        }
+
+        case 4:
+            if (mask & NRF_EDGEAI_FEATURE_BIT_MEAN)
+                p_out[out_num++] = mean;
+            break;
+
+        case 5:
+            if (mask & NRF_EDGEAI_FEATURE_BIT_MAD)
+            {
+                uint32_t deviation = 0;
+                for (uint16_t i = 0; i < num; i++)
+                    deviation += (uint32_t)abs(p_data[i] - mean);
+                p_out[out_num++] = (int32_t)(deviation / num);
+            }
+            break;
+
+        case 6:
+            if (mask & NRF_EDGEAI_FEATURE_BIT_STD)
+            {
+                const int32_t mean_i32 = sum / (int32_t)num;
+                p_out[out_num++] = (int32_t)reference_sqrt_((uint32_t)(tss / num) - (uint32_t)(mean_i32 * mean_i32));
+            }
+            break;
+
+        case 7:
+            if (mask & NRF_EDGEAI_FEATURE_BIT_RMS)
+                p_out[out_num++] = (int32_t)reference_sqrt_((uint32_t)(tss / num));
+            break;
+
+        case 8:
+            if (mask & NRF_EDGEAI_FEATURE_BIT_MCR)
+            {
+                uint32_t crossings = 0;
+                for (uint16_t i = 1; i < num; i++)
+                {
+                    if ((((uint32_t)(p_data[i - 1] - mean) >> 15) & 1) != (((uint32_t)(p_data[i] - mean) >> 15) & 1))
+                        crossings++;
+                }
+                p_out[out_num++] = reference_crossing_rate_(crossings, num);
+            }
+            break;
+
+        case 9:
+            if (mask & NRF_EDGEAI_FEATURE_BIT_ZCR)
+            {
+                uint32_t crossings = 0;
+                for (uint16_t i = 1; i < num; i++)
+                {
+                    if (((uint16_t)p_data[i - 1] >> 15) != ((uint16_t)p_data[i] >> 15))
+                        crossings++;
+                }
+                p_out[out_num++] = reference_crossing_rate_(crossings, num);
+            }
+            break;
+
+        case 10:
+            if (mask & NRF_EDGEAI_FEATURE_BIT_ABSMEAN)
+            {
+                uint32_t abssum = 0;
+                for (uint16_t i = 0; i < num; i++)
+                    abssum += (uint16_t)abs(p_data[i]);
+                p_out[out_num++] = (uint16_t)(abssum / num);
+            }
+            break;
+
+        case 11:
+            if (mask & NRF_EDGEAI_FEATURE_BIT_AMDF)
+            {
+                uint32_t diff_abssum = 0;
+                for (uint16_t i = 1; i < num; i++)
+                    diff_abssum += (uint32_t)abs(p_data[i - 1] - p_data[i]);
+                p_out[out_num++] = (num > 1) ? (int32_t)(diff_abssum / (uint16_t)(num - 1)) : 0;
+            }
+            break;
+
+        case 12:
+            if (mask & NRF_EDGEAI_FEATURE_BIT_PSOZ)
+            {
+                uint16_t positive_num = 0;
+                for (uint16_t i = 0; i < num; i++)
+                    positive_num += (p_data[i] > 0) ? 1 : 0;
+                p_out[out_num++] = (int16_t)((uint32_t)(positive_num * 1000) / num);
+            }
+            break;
+
+        default:
+            if (mask & NRF_EDGEAI_FEATURE_BIT_RMDS)
+            {
+                /** Differences wrap to int16 before squaring */
+                uint32_t diff_square_sum = 0;
+                for (uint16_t i = 1; i < num; i++)
+                {
+                    const int16_t diff = (int16_t)((uint16_t)p_data[i - 1] - (uint16_t)p_data[i]);
+                    diff_square_sum += (uint32_t)((int32_t)diff * diff);
+                }
+                p_out[out_num++] = (int32_t)reference_sqrt_(diff_square_sum);
+            }
+            break;
+    }
+
+    return out_num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t case_check_(uint16_t num, uint16_t head, uint8_t pattern, uint32_t mask)
+{
+    for (uint16_t i = 0; i < num; i++)
+        linear_[i] = pattern_sample_(pattern, i);
+
+    /** Ring storage starts at an odd sample, so the pairs of both segments are unaligned words */
+    int16_t* p_ring = &ring_[1];
+    for (uint16_t i = 0; i < num; i++)
+        p_ring[(head + i) % num] = linear_[i];
+
+    edgeai_span_t span =
+    {
+        .p_seg = { &p_ring[head], p_ring },
+        .num = { num - head, head },
+    };
+
+    const nrf_edgeai_features_timedomain_mask_t timedomain_mask = { .all = mask };
+    edgeai_features_plan_t plan;
+    if (!edgeai_features_plan_compile(&plan, LIBRARY_FUNCS_, LIBRARY_FUNCS_NUM, timedomain_mask, NULL, 0))
+    {
+        printf("plan compile failed, mask 0x%08x\n", mask);
+        return 1;
+    }
+
+    int32_t features[EDGEAI_FEATURES_PLAN_MAX];
+    const uint16_t features_num = edgeai_features_extract(&plan, &span, NULL, NULL, NULL, features);
+
+    int32_t expected[EDGEAI_FEATURES_PLAN_MAX];
+    uint16_t expected_num = 0;
+    for (uint8_t func = 0; func < LIBRARY_FUNCS_NUM; func++)
+        expected_num += reference_func_(func, linear_, num, mask, &expected[expected_num]);
+
+    if ((features_num != expected_num) || (memcmp(features, expected, expected_num * sizeof(int32_t)) != 0))
+    {
+        printf("num %u head %u pattern %u mask 0x%08x: %u features, expected %u\n",
+               num, head, pattern, mask, features_num, expected_num);
+        for (uint16_t i = 0; i < MIN(features_num, expected_num); i++)
+        {
+            if (features[i] != expected[i])
+                printf("  feature %u is %d, expected %d\n", i, features[i], expected[i]);
+        }
+        return 1;
+    }
+
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int main(void)
+{
+    uint32_t errors_num = 0;
+    uint32_t cases_num = 0;
+
+    /** Every wrap position of the short spans, where the pair passes leave tails */
+    for (uint16_t num = 1; num <= 9; num++)
+    {
+        for (uint16_t head = 0; head < num; head++)
+        {
+            for (uint8_t pattern = 0; pattern < PATTERNS_NUM; pattern++)
+            {
+                errors_num += case_check_(num, head, pattern, UINT32_MAX);
+                cases_num++;
+            }
+        }
+    }
+
+    /** Random lengths, wrap positions and masks */
+    for (uint32_t i = 0; i < CASES_NUM; i++)
+    {
+        const uint16_t num = 1 + random_() % SPAN_LEN_MAX;
+        const uint16_t head = random_() % num;
+        const uint32_t mask = (random_() & 1) ? UINT32_MAX : random_();
+
+        errors_num += case_check_(num, head, i % PATTERNS_NUM, mask);
+        cases_num++;
+    }
+
+    printf("edgeai_features (%s backend): %u cases, %u mismatches\n",
+           IS_ENABLED(CONFIG_EDGEAI_FEATURES_BACKEND_DSP) ? "DSP" : "C", cases_num, errors_num);
+
+    return (errors_num == 0) ? 0 : 1;
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_minmax.h"
+#include "edgeai_window.h"
+#include <zephyr/sys/util.h>
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <stdio.h>
+
+/**
+ * Window minimum and maximum of the deques are compared with a brute-force scan of the window span.
+ * Random frames, runs of few values with ties and monotonic ramps that fill the deques are pushed
+ * into the ring window, wrapping it at every position and the 16-bit deque positions past 65536
+ * samples. Some axes skip some windows, also by more than a window, as the axes whose plans need
+ * no extrema, the window shift is changed between the windows and the stream restarts from zero
+ * with the trackers reset, as the runtime window reset does.
+ */
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define AXES_MAX              (6)
+/** Deques capacity of the runtime trackers */
+#define MINMAX_WINDOW_MAX     (128)
+#define RING_CAPACITY_MAX     (300)
+#define FRAMES_BLOCK_MAX      (200)
+#define WINDOW_CASES_NUM      (400)
+#define WINDOW_STEPS_NUM      (1000)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t random_state_ = 12345;
+static int16_t ring_buffer_[RING_CAPACITY_MAX * AXES_MAX];
+static int16_t frames_[FRAMES_BLOCK_MAX * AXES_MAX];
+static uint16_t positions_[AXES_MAX * 2 * MINMAX_WINDOW_MAX];
+static uint32_t windows_num_ = 0;
+static uint32_t restarts_num_ = 0;
+static uint32_t max_start_ = 0;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t random_(void)
+{
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+
+    return random_state_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void random_frames_(int16_t* p_frames, uint16_t frames_num, uint16_t axes_num)
+{
+    const uint32_t kind = random_() % 3;
+    int16_t ramp = (int16_t)random_();
+    const int16_t ramp_step = (int16_t)(random_() % 5) - 2;
+
+    for (uint32_t i = 0; i < (uint32_t)frames_num * axes_num; i++)
+    {
+        if (kind == 0)
+        {
+            p_frames[i] = (int16_t)random_();
+        }
+        else if (kind == 1)
+        {
+            /** Few values, the equal candidates are replaced by the newer ones */
+            p_frames[i] = (int16_t)(random_() % 4) - 2;
+        }
+        else
+        {
+            /** Ramps keep every sample in one of the deques */
+            p_frames[i] = ramp;
+            if ((i % axes_num) == (uint32_t)(axes_num - 1))
+                ramp = (int16_t)(ramp + ramp_step);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void span_extrema_(const edgeai_span_t* p_span, edgeai_extrema_t* p_extrema)
+{
+    p_extrema->min = INT16_MAX;
+    p_extrema->max = INT16_MIN;
+
+    for (uint8_t seg = 0; seg < 2; seg++)
+    {
+        for (uint16_t i = 0; i < p_span->num[seg]; i++)
+        {
+            p_extrema->min = MIN(p_extrema->min, p_span->p_seg[seg][i]);
+            p_extrema->max = MAX(p_extrema->max, p_span->p_seg[seg][i]);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t window_check_(uint16_t capacity, uint16_t size, uint16_t shift, uint16_t axes_num)
+{
+    edgeai_window_t window;
+    edgeai_window_init(&window, ring_buffer_, capacity, size, shift, axes_num);
+
+    edgeai_minmax_t minmax[AXES_MAX];
+    for (uint16_t axis = 0; axis < axes_num; axis++)
+        edgeai_minmax_init(&minmax[axis], &positions_[axis * 2 * MINMAX_WINDOW_MAX], MINMAX_WINDOW_MAX);
+
+    /** Windows left out by the axis in a row */
+    uint16_t skips[AXES_MAX] = { 0 };
+
+    for (uint16_t step = 0; step < WINDOW_STEPS_NUM; step++)
+    {
+        const uint16_t frames_num = random_() % (FRAMES_BLOCK_MAX + 1);
+        random_frames_(frames_, frames_num, axes_num);
+        edgeai_window_push(&window, frames_, frames_num);
+
+        while (edgeai_window_ready(&window) > 0)
+        {
+            const uint32_t start = edgeai_window_start(&window);
+
+            for (uint16_t axis = 0; axis < axes_num; axis++)
+            {
+                /** Axis without extrema needed in this window, some of them for a few windows */
+                if ((skips[axis] > 0) || ((random_() % 4) == 0))
+                {
+                    skips[axis] = (skips[axis] > 0) ? (skips[axis] - 1) : (random_() % 4);
+                    continue;
+                }
+
+                edgeai_span_t span;
+                edgeai_window_span(&window, axis, &span);
+
+                edgeai_extrema_t extrema;
+                edgeai_minmax_window(&minmax[axis], &span, start, &extrema);
+
+                edgeai_extrema_t expected;
+                span_extrema_(&span, &expected);
+
+                if ((extrema.min != expected.min) || (extrema.max != expected.max))
+                {
+                    printf("capacity %u size %u shift %u axis %u: window at %u min %d max %d, expected %d %d\n",
+                           capacity, size, window.shift, axis, start, extrema.min, extrema.max,
+                           expected.min, expected.max);
+                    return 1;
+                }
+            }
+
+            windows_num_++;
+            max_start_ = MAX(max_start_, start);
+
+            edgeai_window_slide(&window);
+
+            /** Shift of the next window, e.g. a latency trade-off changed at runtime */
+            if ((random_() % 16) == 0)
+                edgeai_window_set_shift(&window, 1 + random_() % size);
+        }
+
+        /** Stream restarts from zero, the trackers are reset with the window */
+        if ((random_() % 256) == 0)
+        {
+            edgeai_window_init(&window, ring_buffer_, capacity, size, window.shift, axes_num);
+            for (uint16_t axis = 0; axis < axes_num; axis++)
+                edgeai_minmax_reset(&minmax[axis]);
+            restarts_num_++;
+        }
+    }
+
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int main(void)
+{
+    uint32_t errors_num = 0;
+
+    /** Windows up to the deques capacity, ring capacities equal to the window and longer */
+    for (uint32_t i = 0; i < WINDOW_CASES_NUM; i++)
+    {
+        const uint16_t size = 1 + random_() % MINMAX_WINDOW_MAX;
+        const uint16_t shift = 1 + random_() % size;
+        const uint16_t capacity = (i % 3 == 0) ? size : (size + random_() % (RING_CAPACITY_MAX - size + 1));
+        const uint16_t axes_num = (random_() & 1) ? 6 : (1 + random_() % AXES_MAX);
+
+        errors_num += window_check_(capacity, size, shift, axes_num);
+    }
+
+    printf("edgeai_minmax: %u windows, %u restarts, streams up to %u samples, %u mismatches\n",
+           windows_num_, restarts_num_, max_start_, errors_num);
+
+    /** The 16-bit positions wrapped at least once */
+    return ((errors_num == 0) && (max_start_ > UINT16_MAX)) ? 0 : 1;
+}
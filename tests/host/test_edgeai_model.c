@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_model_packed.h"
+#include "edgeai_model_unrolled.h"
+#include "edgeai_neuton.h"
+#include <nrf_edgeai/rt/private/nrf_edgeai_interfaces.h>
+#include <nrf_edgeai_user_model.h>
+#include <zephyr/sys/util.h>
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * Application side q16 model kernels generated by scripts/neuton_codegen.py are compared with
+ * a transcription of the library interpreter, nrf_nn_neuton_run_inference_q16(), on a corpus of
+ * random and saturated model inputs. The neurons buffer keeps random values of a previous
+ * inference, as the library buffer does. Activations are compared with the register-level
+ * transcription of the library sigmoid over random and knot-adjacent arguments.
+ * The committed model must be the one the kernels are generated from, so the test fails when
+ * the model is regenerated without regenerating the kernels.
+ */
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define ACTIVATION_CASES_NUM    (4000000)
+#define INFERENCE_CASES_NUM     (300000)
+#define INPUT_PATTERNS_NUM      (6)
+#define BENCH_RUNS_NUM          (100000)
+#define BENCH_ARGS_NUM          (4096)
+
+/** Input of the links beyond the model inputs */
+#define BIAS_INPUT_Q16          (65535)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t random_state_ = 12345;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t random_(void)
+{
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+
+    return random_state_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Library sigmoid, transcribed from its instructions: 32-bit words, 16-bit masking and divisions as executed */
+static uint16_t library_sigmoid_q16_(uint16_t weight, int64_t acc)
+{
+    const uint64_t low_product = (uint64_t)weight * (uint32_t)acc;
+    const uint32_t high = weight * (uint32_t)((uint64_t)acc >> 32) + (uint32_t)(low_product >> 32);
+    const uint32_t x_low = ((uint32_t)low_product >> 25) | (high << 7);
+    const int64_t x = (int64_t)(((uint64_t)(uint32_t)((int32_t)high >> 25) << 32) | x_low);
+    const uint32_t magnitude = ((int32_t)x_low < 0) ? (0u - x_low) : x_low;
+    const uint32_t k = magnitude >> 16;
+    const uint32_t fraction = magnitude & 0xFFFF;
+    uint32_t lower = 0;
+    uint32_t upper = 0;
+
+    if (k == 0)
+    {
+        if (fraction == 0)
+            return 32768;
+
+        lower = 32768;
+        for (uint32_t i = 0; i < 16; i++)
+            upper |= (i & 1) << (15 - i);
+    }
+    else if (fraction == 0)
+    {
+        /** Digits of the knot, inverted for the positive argument */
+        const uint32_t is_positive = (x >= 1) ? 1 : 0;
+        for (uint32_t i = 0; i < 16; i++)
+            lower |= (((i / k) + is_positive) & 1) << (15 - i);
+
+        return (uint16_t)lower;
+    }
+    else
+    {
+        const uint32_t next = (k + 1) & 0xFFFF;
+        for (uint32_t i = 0; i < 16; i++)
+        {
+            lower |= ((i / k) & 1) << (15 - i);
+            upper |= ((next != 0) ? ((i / next) & 1) : 0) << (15 - i);
+        }
+    }
+
+    const uint16_t value = (uint16_t)(lower + (uint32_t)((int32_t)((upper - lower) * fraction) >> 16));
+    if (x < 1)
+        return value;
+
+    return (value == 0) ? UINT16_MAX : (uint16_t)(0u - value);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint16_t library_relu_q16_(int64_t acc)
+{
+    const int64_t value = acc >> 15;
+
+    return (value < 0) ? 0 : ((value > UINT16_MAX) ? UINT16_MAX : (uint16_t)value);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Library interpreter transcription, the generated model runs it as its inference interface */
+void nrf_edgeai_run_model_inference_q16(nrf_edgeai_t* p_edgeai)
+{
+    const nrf_edgeai_model_meta_t* p_meta = &p_edgeai->model.meta;
+    const int16_t* p_weights = p_edgeai->model.params.q16.p_weights;
+    const uint16_t* p_act_weights = p_edgeai->model.params.q16.p_act_weights;
+    const uint16_t* p_inputs = (const uint16_t*)p_edgeai->p_dsp->features.extracted_memory.p_void;
+    const uint16_t inputs_num = p_edgeai->p_dsp->features.overall_num;
+    uint16_t* p_neurons = p_edgeai->model.params.q16.p_neurons;
+    uint32_t link = 0;
+
+    for (uint32_t n = 0; n < p_meta->neurons_num; n++)
+    {
+        int64_t acc = 0;
+
+        for (; link < p_meta->p_neuron_internal_links_num[n]; link++)
+            acc += (int64_t)p_weights[link] * p_neurons[p_meta->p_neuron_links[link]];
+
+        for (; link < p_meta->p_neuron_external_links_num[n]; link++)
+        {
+            const uint16_t input = p_meta->p_neuron_links[link];
+            acc += (int32_t)p_weights[link] * (int32_t)((input < inputs_num) ? p_inputs[input] : BIAS_INPUT_Q16);
+        }
+
+        const bool is_relu = (p_meta->p_neuron_act_type_mask[n / 8] >> (n % 8)) & 1;
+        p_neurons[n] = is_relu ? library_relu_q16_(acc) : library_sigmoid_q16_(p_act_weights[n], acc);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int64_t random_acc_(uint32_t i)
+{
+    switch (i % 4)
+    {
+        case 0:
+            return (int32_t)random_();
+        case 1:
+            return (int64_t)(int32_t)random_() * (int64_t)(random_() % 64);
+        case 2:
+            return (int32_t)random_() >> (random_() % 31);
+        default:
+            return (int64_t)(((uint64_t)random_() << 32) | random_()) >> (random_() % 40);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t activations_check_(const nrf_edgeai_t* p_edgeai)
+{
+    uint32_t errors_num = 0;
+
+    for (uint32_t i = 0; i < ACTIVATION_CASES_NUM; i++)
+    {
+        /** Activation weights of the model and random ones */
+        const uint16_t weight = (i % 5 == 0) ? p_edgeai->model.params.q16.p_act_weights[random_() % p_edgeai->model.meta.neurons_num]
+                                             : (uint16_t)random_();
+        const int64_t acc = random_acc_(i);
+        const uint16_t expected = library_sigmoid_q16_(weight, acc);
+
+        if ((edgeai_neuton_sigmoid_ref_q16(weight, acc) != expected) ||
+            (edgeai_neuton_sigmoid_lut_q16(weight, acc) != expected) ||
+            (edgeai_neuton_relu_q16(acc) != library_relu_q16_(acc)))
+        {
+            if (errors_num < 8)
+                printf("activation weight %u acc %lld differs\n", weight, (long long)acc);
+            errors_num++;
+        }
+    }
+
+    /** Every Q16 argument around the first knots, where the interpolation and inversion change */
+    for (int64_t acc = -(1 << 22); acc < (1 << 22); acc++)
+    {
+        if ((edgeai_neuton_sigmoid_ref_q16(40959, acc) != library_sigmoid_q16_(40959, acc)) ||
+            (edgeai_neuton_sigmoid_lut_q16(UINT16_MAX, acc << 9) != library_sigmoid_q16_(UINT16_MAX, acc << 9)))
+        {
+            if (errors_num < 8)
+                printf("activation acc %lld differs\n", (long long)acc);
+            errors_num++;
+        }
+    }
+
+    return errors_num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint16_t pattern_input_(uint8_t pattern)
+{
+    switch (pattern)
+    {
+        case 0:
+            return (uint16_t)random_();
+        case 1:
+            return (random_() & 1) ? UINT16_MAX : 0;
+        case 2:
+            return (uint16_t)(32768 + (int32_t)(random_() % 2001) - 1000);
+        case 3:
+            return (uint16_t)(random_() % 4096);
+        case 4:
+            return (uint16_t)(UINT16_MAX - random_() % 4096);
+        default:
+            return (uint16_t)(random_() >> (random_() % 17));
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t kernel_check_(nrf_edgeai_t* p_edgeai, const char* p_name, void (*run_inference)(nrf_edgeai_t*))
+{
+    uint16_t* p_inputs = (uint16_t*)p_edgeai->p_dsp->features.extracted_memory.p_void;
+    uint16_t* p_neurons = p_edgeai->model.params.q16.p_neurons;
+    const uint16_t inputs_num = p_edgeai->p_dsp->features.overall_num;
+    const uint16_t neurons_num = p_edgeai->model.meta.neurons_num;
+    uint16_t previous[neurons_num];
+    uint16_t expected[neurons_num];
+    uint32_t errors_num = 0;
+
+    for (uint32_t i = 0; i < INFERENCE_CASES_NUM; i++)
+    {
+        for (uint16_t input = 0; input < inputs_num; input++)
+            p_inputs[input] = pattern_input_(i % INPUT_PATTERNS_NUM);
+        for (uint16_t n = 0; n < neurons_num; n++)
+            previous[n] = (uint16_t)random_();
+
+        memcpy(p_neurons, previous, sizeof(previous));
+        nrf_edgeai_run_model_inference_q16(p_edgeai);
+        memcpy(expected, p_neurons, sizeof(expected));
+
+        memcpy(p_neurons, previous, sizeof(previous));
+        run_inference(p_edgeai);
+
+        if (memcmp(p_neurons, expected, sizeof(expected)) != 0)
+        {
+            if (errors_num < 8)
+                printf("%s: inference %u differs\n", p_name, i);
+            errors_num++;
+        }
+    }
+
+    return errors_num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static double bench_ns_(nrf_edgeai_t* p_edgeai, void (*run_inference)(nrf_edgeai_t*))
+{
+    struct timespec start;
+    struct timespec stop;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < BENCH_RUNS_NUM; i++)
+        run_inference(p_edgeai);
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    return ((stop.tv_sec - start.tv_sec) * 1e9 + (stop.tv_nsec - start.tv_nsec)) / BENCH_RUNS_NUM;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static double bench_sigmoid_ns_(const uint16_t* p_weights, const int64_t* p_accs, uint16_t (*sigmoid)(uint16_t, int64_t))
+{
+    struct timespec start;
+    struct timespec stop;
+    volatile uint16_t sink = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t run = 0; run < BENCH_RUNS_NUM / 100; run++)
+    {
+        for (uint32_t i = 0; i < BENCH_ARGS_NUM; i++)
+            sink = sigmoid(p_weights[i], p_accs[i]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+    (void)sink;
+
+    return ((stop.tv_sec - start.tv_sec) * 1e9 + (stop.tv_nsec - start.tv_nsec)) / (BENCH_RUNS_NUM / 100 * BENCH_ARGS_NUM);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int main(void)
+{
+    nrf_edgeai_t* p_edgeai = nrf_edgeai_user_model();
+    uint32_t errors_num = 0;
+
+    if (!edgeai_model_unrolled_supported(p_edgeai) || !edgeai_model_packed_supported(p_edgeai))
+    {
+        printf("edgeai_model_unrolled.c or edgeai_model_packed.c is not generated from the model, run scripts/neuton_codegen.py\n");
+        return 1;
+    }
+
+    errors_num += activations_check_(p_edgeai);
+    errors_num += kernel_check_(p_edgeai, "unrolled", edgeai_model_unrolled_run_inference_q16);
+    errors_num += kernel_check_(p_edgeai, "packed", edgeai_model_packed_run_inference_q16);
+
+    printf("edgeai_model (%s sigmoid): %u mismatches, ns per inference: interpreter %.0f, packed %.0f, unrolled %.0f, "
+           "graph bytes: library %u, packed %u\n",
+           IS_ENABLED(CONFIG_EDGEAI_SIGMOID_LUT) ? "table" : "reference",
+           errors_num,
+           bench_ns_(p_edgeai, nrf_edgeai_run_model_inference_q16),
+           bench_ns_(p_edgeai, edgeai_model_packed_run_inference_q16),
+           bench_ns_(p_edgeai, edgeai_model_unrolled_run_inference_q16),
+           edgeai_neuton_graph_size_q16(&p_edgeai->model),
+           edgeai_model_packed.stream_size);
+
+    /** Activation weights of the sigmoid neurons of the model, arguments of both signs over the knots */
+    const nrf_edgeai_model_meta_t* p_meta = &p_edgeai->model.meta;
+    static uint16_t weights[BENCH_ARGS_NUM];
+    static int64_t accs[BENCH_ARGS_NUM];
+    for (uint32_t i = 0; i < BENCH_ARGS_NUM; i++)
+    {
+        uint16_t n;
+        do
+            n = random_() % p_meta->neurons_num;
+        while ((p_meta->p_neuron_act_type_mask[n / 8] >> (n % 8)) & 1);
+
+        weights[i] = p_edgeai->model.params.q16.p_act_weights[n];
+        accs[i] = (int32_t)random_() >> (random_() % 8);
+    }
+
+    printf("edgeai_model (%s sigmoid): ns per sigmoid: reference %.1f, table %.1f\n",
+           IS_ENABLED(CONFIG_EDGEAI_SIGMOID_LUT) ? "table" : "reference",
+           bench_sigmoid_ns_(weights, accs, edgeai_neuton_sigmoid_ref_q16),
+           bench_sigmoid_ns_(weights, accs, edgeai_neuton_sigmoid_lut_q16));
+
+    return (errors_num == 0) ? 0 : 1;
+}
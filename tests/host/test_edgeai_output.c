@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+// ///////////////////////// Package Header Files ////////////////////////////
+#include <nrf_edgeai/rt/private/nrf_edgeai_interfaces.h>
+#include "edgeai_runtime.h"
+#include "inference_postprocessing.h"
+#include <zephyr/sys/util.h>
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Q16 classification decode of the runtime and fixed-point postprocessing are compared with the
+ * library float decode, transcribed from its disassembly, and with the float postprocessing,
+ * inference_postprocessing.c built without CONFIG_EDGEAI_FIXED_POINT_OUTPUT as
+ * inference_postprocess_f32(). Streams of random model outputs repeat the predicted class for a few
+ * windows, so the averaged probabilities are thresholded, and some outputs make the probability
+ * of the class exactly or nearly one of the thresholds. Decisions have to be the same unless the exact
+ * average of the probabilities is within the Q16 rounding of the threshold, where the float
+ * rounding decides too, e.g. 0.7 and 0.9 average to 0.8 but are rejected by the float path.
+ */
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define CLASSES_NUM             (8)
+#define PREDICTIONS_NUM         (1000000)
+/** Q16 probability of the runtime decode is rounded to nearest */
+#define PROBABILITY_TOLERANCE   (0.5 / UINT16_MAX + FLT_EPSILON)
+/** Average of the Q16 probabilities is rounded to nearest too */
+#define AVERAGE_TOLERANCE       (1.0 / UINT16_MAX + FLT_EPSILON)
+/** Averages closer to the threshold may be decided either way */
+#define THRESHOLD_MARGIN        (0.5 / UINT16_MAX + FLT_EPSILON)
+/** Predictions averaged by the postprocessing and the thresholds of the gestures */
+#define AVERAGED_NUM            (2)
+#define SWIPE_THRESHOLD         (0.8)
+#define GESTURE_THRESHOLD       (0.7)
+
+//////////////////////////////////////////////////////////////////////////////
+
+typedef void (*inference_postprocess_f32_cb_t)(const class_label_t class_label,
+                                               const float probability,
+                                               const char* class_name,
+                                               const bool is_raw);
+
+/** Float postprocessing, inference_postprocess() of the float build */
+void inference_postprocess_f32(const uint16_t predicted_target,
+                               const float probability,
+                               const bool do_postprocessing,
+                               inference_postprocess_f32_cb_t callback);
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t random_state_ = 12345;
+static nrf_edgeai_t model_;
+static class_label_t label_;
+static inference_probability_t probability_;
+static class_label_t label_f32_;
+static float probability_f32_;
+
+/** Predictions of the class being averaged, with their exact probabilities */
+static struct
+{
+    uint16_t target;
+    uint16_t num;
+    double probabilities[AVERAGED_NUM];
+} exact_;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Library functions referenced by the runtime, only the output decoding is run by the test */
+
+nrf_edgeai_err_t nrf_edgeai_init(nrf_edgeai_t* p_edgeai) { (void)p_edgeai; return NRF_EDGEAI_ERR_SUCCESS; }
+uint16_t nrf_edgeai_input_window_size(const nrf_edgeai_t* p_edgeai) { (void)p_edgeai; return 1; }
+nrf_edgeai_err_t nrf_edgeai_feed_inputs(nrf_edgeai_t* p_edgeai, void* p_input_values, uint16_t num_values) { abort(); }
+nrf_edgeai_err_t nrf_edgeai_run_inference(nrf_edgeai_t* p_edgeai) { abort(); }
+void nrf_edgeai_output_propagate_q16(nrf_edgeai_model_t* p_model) { abort(); }
+void nrf_edgeai_output_dequantize_q16_f32(nrf_edgeai_model_t* p_model) { abort(); }
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Library float decode: outputs normalized by their sum, first of the max outputs predicted */
+void nrf_edgeai_output_decode_classification_f32(nrf_edgeai_model_output_t* p_model_output,
+                                                 nrf_edgeai_decoded_output_t* p_decoded_output)
+{
+    flt32_t* p_outputs = p_model_output->memory.p_f32;
+    flt32_t sum = 0.0f;
+    flt32_t max = 0.0f;
+    uint16_t predicted_class = 0;
+
+    for (uint16_t i = 0; i < p_model_output->num; i++)
+        sum += p_outputs[i];
+
+    if (sum > FLT_EPSILON)
+    {
+        for (uint16_t i = 0; i < p_model_output->num; i++)
+            p_outputs[i] = p_outputs[i] / sum;
+    }
+    else
+    {
+        memset(p_outputs, 0, p_model_output->num * sizeof(flt32_t));
+    }
+
+    for (uint16_t i = 0; i < p_model_output->num; i++)
+    {
+        if (p_outputs[i] > max)
+        {
+            max = p_outputs[i];
+            predicted_class = i;
+        }
+    }
+
+    p_decoded_output->classif.predicted_class = predicted_class;
+    p_decoded_output->classif.num_classes = p_model_output->num;
+    p_decoded_output->classif.probabilities.p_f32 = p_outputs;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t random_(void)
+{
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+
+    return random_state_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void prediction_cb_(const class_label_t class_label,
+                           const inference_probability_t probability,
+                           const char* class_name,
+                           const bool is_raw)
+{
+    (void)class_name;
+    (void)is_raw;
+
+    label_ = class_label;
+    probability_ = probability;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void prediction_f32_cb_(const class_label_t class_label,
+                               const float probability,
+                               const char* class_name,
+                               const bool is_raw)
+{
+    (void)class_name;
+    (void)is_raw;
+
+    label_f32_ = class_label;
+    probability_f32_ = probability;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Distance of the exact average of the predictions of the class from its threshold,
+ *  INFINITY if the postprocessing does not threshold this prediction */
+static double exact_margin_(uint16_t predicted, const uint16_t* p_outputs)
+{
+    if ((predicted == CLASS_LABEL_IDLE) || (predicted == CLASS_LABEL_UNKNOWN) || (exact_.target != predicted))
+    {
+        exact_.target = predicted;
+        exact_.num = 0;
+    }
+
+    if ((predicted == CLASS_LABEL_IDLE) || (predicted == CLASS_LABEL_UNKNOWN))
+        return INFINITY;
+
+    uint32_t sum = 0;
+    for (uint16_t i = 0; i < CLASSES_NUM; i++)
+        sum += p_outputs[i];
+
+    exact_.probabilities[exact_.num++] = (double)p_outputs[predicted] / sum;
+    if (exact_.num < AVERAGED_NUM)
+        return INFINITY;
+
+    exact_.num = 0;
+
+    const double average = (exact_.probabilities[0] + exact_.probabilities[1]) / AVERAGED_NUM;
+    const bool is_swipe = (predicted == CLASS_LABEL_SWIPE_LEFT) || (predicted == CLASS_LABEL_SWIPE_RIGHT);
+
+    return fabs(average - (is_swipe ? SWIPE_THRESHOLD : GESTURE_THRESHOLD));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Model outputs of one window, the dominant class takes most of the sum */
+static void random_outputs_(uint16_t* p_outputs, uint16_t dominant)
+{
+    const uint32_t kind = random_() % 4;
+
+    if (kind == 0)
+    {
+        for (uint16_t i = 0; i < CLASSES_NUM; i++)
+            p_outputs[i] = (uint16_t)random_();
+    }
+    else if (kind == 3)
+    {
+        /** Probability of the dominant class is 0.9 or 0.7, averaged to the thresholds 0.8 or 0.7,
+         *  exactly or a few Q16 steps off */
+        const uint16_t rest = (random_() & 1) ? 1 : 3;
+        const uint16_t unit = (uint16_t)(1 + random_() % (UINT16_MAX / (10 - rest) - 3));
+        const int16_t offset = (random_() & 1) ? 0 : (int16_t)(random_() % 7) - 3;
+
+        memset(p_outputs, 0, CLASSES_NUM * sizeof(uint16_t));
+        p_outputs[dominant] = (uint16_t)MAX((10 - rest) * unit + offset, 1);
+        for (uint16_t i = 0; i < rest * unit; i++)
+            p_outputs[(dominant + 1 + random_() % (CLASSES_NUM - 1)) % CLASSES_NUM]++;
+    }
+    else
+    {
+        const uint16_t spread = (uint16_t)(1 + random_() % 8000);
+
+        for (uint16_t i = 0; i < CLASSES_NUM; i++)
+            p_outputs[i] = (uint16_t)(random_() % spread);
+        p_outputs[dominant] = (uint16_t)(spread + random_() % (UINT16_MAX - spread + 1));
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int main(void)
+{
+    model_.interfaces.propagate_outputs = nrf_edgeai_output_dequantize_q16_f32;
+    model_.interfaces.decode_outputs = nrf_edgeai_output_decode_classification_f32;
+
+    if ((edgeai_runtime_init(&model_, NULL, 0) != NRF_EDGEAI_ERR_SUCCESS) ||
+        (model_.interfaces.decode_outputs == nrf_edgeai_output_decode_classification_f32))
+    {
+        printf("Q16 decode is not set up\n");
+        return 1;
+    }
+
+    uint32_t class_mismatches_num = 0;
+    uint32_t probability_mismatches_num = 0;
+    uint32_t decision_mismatches_num = 0;
+    uint32_t near_threshold_num = 0;
+    uint32_t accepted_num = 0;
+    uint16_t dominant = 0;
+
+    for (uint32_t n = 0; n < PREDICTIONS_NUM; n++)
+    {
+        /** Gestures last a few windows */
+        if ((random_() % 4) == 0)
+            dominant = random_() % CLASSES_NUM;
+
+        uint16_t outputs[CLASSES_NUM];
+        random_outputs_(outputs, dominant);
+
+        /** Library dequantization, q16 model outputs scaled by 2^-16 */
+        flt32_t outputs_f32[CLASSES_NUM];
+        for (uint16_t i = 0; i < CLASSES_NUM; i++)
+            outputs_f32[i] = (flt32_t)outputs[i] * (1.0f / 65536.0f);
+
+        /** Decoded in place */
+        uint16_t probabilities[CLASSES_NUM];
+        memcpy(probabilities, outputs, sizeof(outputs));
+
+        nrf_edgeai_model_output_t output = { .memory.p_q16 = probabilities, .num = CLASSES_NUM };
+        nrf_edgeai_model_output_t output_f32 = { .memory.p_f32 = outputs_f32, .num = CLASSES_NUM };
+        nrf_edgeai_decoded_output_t decoded;
+        nrf_edgeai_decoded_output_t decoded_f32;
+        model_.interfaces.decode_outputs(&output, &decoded);
+        nrf_edgeai_output_decode_classification_f32(&output_f32, &decoded_f32);
+
+        const uint16_t predicted = decoded.classif.predicted_class;
+        if (predicted != decoded_f32.classif.predicted_class)
+        {
+            if (class_mismatches_num++ < 8)
+                printf("prediction %u: class %u, float %u\n", n, predicted, decoded_f32.classif.predicted_class);
+            continue;
+        }
+
+        for (uint16_t i = 0; i < CLASSES_NUM; i++)
+        {
+            const double probability = (double)decoded.classif.probabilities.p_q16[i] / UINT16_MAX;
+            if (fabs(probability - decoded_f32.classif.probabilities.p_f32[i]) > PROBABILITY_TOLERANCE)
+            {
+                if (probability_mismatches_num++ < 8)
+                    printf("prediction %u class %u: probability %.9f, float %.9f\n",
+                           n, i, probability, decoded_f32.classif.probabilities.p_f32[i]);
+            }
+        }
+
+        const double margin = exact_margin_(predicted, outputs);
+        inference_postprocess(predicted, decoded.classif.probabilities.p_q16[predicted], true, prediction_cb_);
+        inference_postprocess_f32(predicted, decoded_f32.classif.probabilities.p_f32[predicted], true, prediction_f32_cb_);
+
+        const double average = (double)probability_ / UINT16_MAX;
+        if ((label_ != label_f32_) || (fabs(average - probability_f32_) > AVERAGE_TOLERANCE))
+        {
+            if (margin <= THRESHOLD_MARGIN)
+            {
+                near_threshold_num++;
+            }
+            else if (decision_mismatches_num++ < 8)
+            {
+                printf("prediction %u: label %d probability %.9f, float %d %.9f, %.9f from the threshold\n",
+                       n, label_, average, label_f32_, probability_f32_, margin);
+            }
+        }
+
+        accepted_num += (label_ == predicted) && (label_ != CLASS_LABEL_UNKNOWN) && (label_ != CLASS_LABEL_IDLE);
+    }
+
+    printf("edgeai_output: %u predictions, %u gestures accepted, %u decided otherwise at the threshold, "
+           "mismatches: %u classes, %u probabilities, %u decisions\n",
+           PREDICTIONS_NUM, accepted_num, near_threshold_num,
+           class_mismatches_num, probability_mismatches_num, decision_mismatches_num);
+
+    const bool is_passed = (class_mismatches_num == 0) && (probability_mismatches_num == 0) &&
+                           (decision_mismatches_num == 0) && (accepted_num > 0);
+
+    return is_passed ? 0 : 1;
+}
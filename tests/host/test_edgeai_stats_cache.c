@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_stats_cache.h"
+#include "edgeai_window.h"
+#include <zephyr/sys/util.h>
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * Window statistics combined from the cached blocks are compared with a direct pass over the
+ * window samples of the stream. Random frames are pushed into the ring window, wrapping it at every
+ * position, the ready windows are read by their stream positions and some axes skip some windows,
+ * as the axes whose plans need no statistics, so their blocks are stale. Window shifts are changed
+ * between the windows and the cache is set up again as edgeai_runtime_set_window_shift() does,
+ * including the shifts whose blocks are too many or a whole window, which are not cached.
+ */
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define AXES_MAX               (6)
+#define BLOCKS_MAX             (9)
+#define WINDOW_SIZE_MAX        (240)
+#define RING_CAPACITY_MAX      (400)
+#define FRAMES_BLOCK_MAX       (200)
+#define WINDOW_CASES_NUM       (2000)
+#define WINDOW_STEPS_NUM       (200)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t random_state_ = 12345;
+static int16_t ring_buffer_[RING_CAPACITY_MAX * AXES_MAX];
+/** Stream of the pushed frames, the windows are checked against it by their stream positions */
+static int16_t stream_[(WINDOW_STEPS_NUM * FRAMES_BLOCK_MAX) * AXES_MAX];
+static edgeai_block_stats_t blocks_[AXES_MAX * BLOCKS_MAX];
+static uint32_t windows_num_ = 0;
+static uint32_t uncached_windows_num_ = 0;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t random_(void)
+{
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+
+    return random_state_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint16_t gcd_(uint16_t a, uint16_t b)
+{
+    while (b != 0)
+    {
+        const uint16_t rem = a % b;
+        a = b;
+        b = rem;
+    }
+
+    return a;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Same blocks as the runtime cache setup, false if the window is not cached */
+static bool cache_setup_(edgeai_stats_cache_t* p_cache, const edgeai_window_t* p_window)
+{
+    const uint16_t block_size = gcd_(p_window->size, p_window->shift);
+    const uint16_t blocks_num = p_window->size / block_size;
+
+    if ((blocks_num <= 1) || (blocks_num > BLOCKS_MAX))
+        return false;
+
+    edgeai_stats_cache_init(p_cache, blocks_, block_size, blocks_num, p_window->axes_num);
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Direct pass over the window samples, sums wrap as the library int32 sums and the first sample
+ *  has no neighbor */
+static void window_stats_(const int16_t* p_samples, uint16_t num, uint16_t stride,
+                          edgeai_stat_ctx_t* p_ctx, edgeai_pairwise_t* p_pairwise)
+{
+    memset(p_ctx, 0, sizeof(*p_ctx));
+    memset(p_pairwise, 0, sizeof(*p_pairwise));
+    p_ctx->min = INT16_MAX;
+    p_ctx->max = INT16_MIN;
+
+    uint32_t sum = 0;
+
+    for (uint16_t i = 0; i < num; i++)
+    {
+        const int32_t value = p_samples[i * stride];
+
+        sum += (uint32_t)value;
+        p_ctx->abssum += (uint32_t)((value < 0) ? -value : value);
+        p_ctx->tss += (uint64_t)(value * value);
+        p_ctx->positive_num += (value > 0);
+        p_ctx->min = MIN(p_ctx->min, value);
+        p_ctx->max = MAX(p_ctx->max, value);
+
+        if (i > 0)
+        {
+            const int32_t prev = p_samples[(i - 1) * stride];
+            const int16_t wrapped_diff = (int16_t)(prev - value);
+
+            p_pairwise->zero_crossings += ((prev < 0) != (value < 0));
+            p_pairwise->diff_abssum += (uint32_t)((prev > value) ? (prev - value) : (value - prev));
+            p_pairwise->diff_square_sum += (uint32_t)(wrapped_diff * wrapped_diff);
+        }
+    }
+
+    p_ctx->sum = (int32_t)sum;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static bool is_equal_(const edgeai_stat_ctx_t* p_a, const edgeai_pairwise_t* p_a_pairwise,
+                      const edgeai_stat_ctx_t* p_b, const edgeai_pairwise_t* p_b_pairwise)
+{
+    return (p_a->sum == p_b->sum) && (p_a->tss == p_b->tss) && (p_a->abssum == p_b->abssum) &&
+           (p_a->positive_num == p_b->positive_num) && (p_a->min == p_b->min) && (p_a->max == p_b->max) &&
+           (p_a_pairwise->zero_crossings == p_b_pairwise->zero_crossings) &&
+           (p_a_pairwise->diff_abssum == p_b_pairwise->diff_abssum) &&
+           (p_a_pairwise->diff_square_sum == p_b_pairwise->diff_square_sum);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void random_frames_(int16_t* p_frames, uint16_t frames_num, uint16_t axes_num)
+{
+    /** Full range samples and small ones around zero, which cross it often */
+    const bool is_small = (random_() & 1);
+
+    for (uint32_t i = 0; i < (uint32_t)frames_num * axes_num; i++)
+        p_frames[i] = is_small ? (int16_t)(random_() % 64 - 32) : (int16_t)random_();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t window_check_(uint16_t capacity, uint16_t size, uint16_t shift, uint16_t axes_num)
+{
+    edgeai_window_t window;
+    edgeai_window_init(&window, ring_buffer_, capacity, size, shift, axes_num);
+
+    edgeai_stats_cache_t cache;
+    bool is_cached = cache_setup_(&cache, &window);
+
+    uint32_t pushed_num = 0;
+
+    for (uint16_t step = 0; step < WINDOW_STEPS_NUM; step++)
+    {
+        const uint16_t frames_num = random_() % (FRAMES_BLOCK_MAX + 1);
+        int16_t* p_frames = &stream_[pushed_num * axes_num];
+        random_frames_(p_frames, frames_num, axes_num);
+        pushed_num += edgeai_window_push(&window, p_frames, frames_num);
+
+        while (edgeai_window_ready(&window) > 0)
+        {
+            const uint32_t start = edgeai_window_start(&window);
+
+            for (uint16_t axis = 0; is_cached && (axis < axes_num); axis++)
+            {
+                /** Axis without statistics needed in this window */
+                if ((random_() % 4) == 0)
+                    continue;
+
+                edgeai_span_t span;
+                edgeai_window_span(&window, axis, &span);
+
+                edgeai_stat_ctx_t ctx;
+                edgeai_pairwise_t pairwise;
+                edgeai_stats_cache_window(&cache, axis, &span, start, &ctx, &pairwise);
+
+                edgeai_stat_ctx_t expected_ctx;
+                edgeai_pairwise_t expected_pairwise;
+                window_stats_(&stream_[start * axes_num + axis], size, axes_num, &expected_ctx, &expected_pairwise);
+
+                if (!is_equal_(&ctx, &pairwise, &expected_ctx, &expected_pairwise))
+                {
+                    printf("capacity %u size %u shift %u block %u axis %u: window at %u differs, "
+                           "sum %d/%d tss %llu/%llu min %d/%d max %d/%d crossings %d/%d\n",
+                           capacity, size, window.shift, cache.block_size, axis, start,
+                           ctx.sum, expected_ctx.sum,
+                           (unsigned long long)ctx.tss, (unsigned long long)expected_ctx.tss,
+                           ctx.min, expected_ctx.min, ctx.max, expected_ctx.max,
+                           pairwise.zero_crossings, expected_pairwise.zero_crossings);
+                    return 1;
+                }
+            }
+
+            windows_num_ += is_cached;
+            uncached_windows_num_ += !is_cached;
+
+            edgeai_window_slide(&window);
+
+            /** Shift of the next window, e.g. a latency trade-off changed at runtime */
+            if ((random_() % 8) == 0)
+            {
+                const uint16_t block_size = gcd_(size, shift);
+                const uint16_t new_shift = (random_() & 1) ? block_size * (1 + random_() % (size / block_size))
+                                                           : (1 + random_() % size);
+                edgeai_window_set_shift(&window, new_shift);
+                is_cached = cache_setup_(&cache, &window);
+            }
+        }
+    }
+
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int main(void)
+{
+    uint32_t errors_num = 0;
+
+    /** Windows of a few whole blocks, ring capacities equal to the window, not multiples of the shift and much longer */
+    for (uint32_t i = 0; i < WINDOW_CASES_NUM; i++)
+    {
+        const uint16_t blocks_num = 2 + random_() % (BLOCKS_MAX - 1);
+        const uint16_t block_size = 1 + random_() % (WINDOW_SIZE_MAX / blocks_num);
+        const uint16_t size = block_size * blocks_num;
+        const uint16_t shift = block_size * (1 + random_() % blocks_num);
+        const uint16_t capacity = (i % 3 == 0) ? size : (size + random_() % (RING_CAPACITY_MAX - size + 1));
+        const uint16_t axes_num = (random_() & 1) ? 6 : (1 + random_() % AXES_MAX);
+
+        errors_num += window_check_(capacity, size, shift, axes_num);
+    }
+
+    printf("edgeai_stats_cache: %u windows checked, %u windows not cached, %u mismatches\n",
+           windows_num_, uncached_windows_num_, errors_num);
+
+    return ((errors_num == 0) && (windows_num_ > 0)) ? 0 : 1;
+}
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "edgeai_window.h"
+#include "edgeai_deinterleave.h"
+#include <zephyr/sys/util.h>
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * The deinterleave of the selected path is compared with a value by value copy for random
+ * channel counts, frame counts, column strides and unaligned columns and frames, and must not
+ * write past the columns. The ring window is compared with the library flatten sliding window,
+ * columns slid by moving the samples: edgeai_window_feed() step by step, and edgeai_window_push()
+ * with several windows collected at once, read as spans and slices at every wrap position and
+ * slid with shift changes.
+ */
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define AXES_MAX                (8)
+#define WINDOW_SIZE_MAX         (120)
+#define RING_CAPACITY_MAX       (300)
+#define FRAMES_BLOCK_MAX        (200)
+#define DEINTERLEAVE_CASES_NUM  (200000)
+#define WINDOW_CASES_NUM        (3000)
+#define WINDOW_STEPS_NUM        (200)
+/** Guard values around the deinterleaved columns */
+#define GUARD_LEN               (16)
+#define GUARD_VALUE             ((int16_t)0x5A5A)
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Library flatten window: per-axis columns of the window size, slid by moving the samples */
+typedef struct
+{
+    int16_t columns[AXES_MAX][WINDOW_SIZE_MAX];
+    uint16_t size;
+    uint16_t shift;
+    uint16_t axes_num;
+    uint16_t filled;
+} reference_window_t;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t random_state_ = 12345;
+static int16_t frames_[(FRAMES_BLOCK_MAX + 1) * AXES_MAX];
+static int16_t columns_[2 * GUARD_LEN + AXES_MAX * (RING_CAPACITY_MAX + 1)];
+static int16_t ring_buffer_[RING_CAPACITY_MAX * AXES_MAX];
+/** Stream of the pushed frames, the windows are checked against it by their stream positions */
+static int16_t stream_[(WINDOW_STEPS_NUM * FRAMES_BLOCK_MAX) * AXES_MAX];
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t random_(void)
+{
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+
+    return random_state_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t deinterleave_check_(void)
+{
+    const uint16_t channels = 1 + random_() % AXES_MAX;
+    /** Six channel frames take the vector path, they are drawn more often */
+    const uint16_t axes_num = (random_() & 1) ? 6 : channels;
+    const uint16_t frames_num = random_() % (FRAMES_BLOCK_MAX + 1);
+    const uint16_t column_stride = frames_num + random_() % 8;
+    const uint16_t columns_offset = random_() % 2;
+    const uint16_t frames_offset = random_() % 2;
+    const size_t columns_len = (size_t)axes_num * column_stride;
+
+    const int16_t* p_frames = &frames_[frames_offset];
+    for (uint32_t i = 0; i < (uint32_t)frames_num * axes_num; i++)
+        frames_[frames_offset + i] = (int16_t)random_();
+
+    for (size_t i = 0; i < ARRAY_SIZE(columns_); i++)
+        columns_[i] = GUARD_VALUE;
+
+    int16_t* p_columns = &columns_[GUARD_LEN + columns_offset];
+    edgeai_deinterleave_i16(p_columns, column_stride, p_frames, frames_num, axes_num);
+
+    uint32_t errors_num = 0;
+
+    for (uint16_t ch = 0; ch < axes_num; ch++)
+    {
+        for (uint16_t i = 0; i < column_stride; i++)
+        {
+            const int16_t expected = (i < frames_num) ? p_frames[i * axes_num + ch] : GUARD_VALUE;
+            if (p_columns[ch * column_stride + i] != expected)
+                errors_num++;
+        }
+    }
+
+    for (int16_t* p_guard = columns_; p_guard < p_columns; p_guard++)
+        errors_num += (*p_guard != GUARD_VALUE);
+    for (size_t i = GUARD_LEN + columns_offset + columns_len; i < ARRAY_SIZE(columns_); i++)
+        errors_num += (columns_[i] != GUARD_VALUE);
+
+    if (errors_num > 0)
+    {
+        printf("deinterleave: channels %u frames %u stride %u offsets %u/%u, %u wrong values\n",
+               axes_num, frames_num, column_stride, columns_offset, frames_offset, errors_num);
+    }
+
+    return (errors_num > 0) ? 1 : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint16_t reference_feed_(reference_window_t* p_ref, const int16_t* p_frames, uint16_t frames_num)
+{
+    if (p_ref->filled >= p_ref->size)
+    {
+        for (uint16_t axis = 0; axis < p_ref->axes_num; axis++)
+        {
+            memmove(p_ref->columns[axis], &p_ref->columns[axis][p_ref->shift],
+                    (p_ref->size - p_ref->shift) * sizeof(int16_t));
+        }
+        p_ref->filled -= p_ref->shift;
+    }
+
+    const uint16_t stored_num = MIN(frames_num, p_ref->size - p_ref->filled);
+    for (uint16_t i = 0; i < stored_num; i++)
+    {
+        for (uint16_t axis = 0; axis < p_ref->axes_num; axis++)
+            p_ref->columns[axis][p_ref->filled + i] = p_frames[i * p_ref->axes_num + axis];
+    }
+    p_ref->filled += stored_num;
+
+    return p_ref->size - p_ref->filled;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Span and random slices of it against the expected column */
+static uint32_t span_check_(const edgeai_span_t* p_span, const int16_t* p_expected, uint16_t num, uint16_t stride)
+{
+    if ((p_span->num[0] + p_span->num[1] != num) || ((num > 0) && (p_span->num[0] == 0)))
+        return 1;
+
+    uint16_t i = 0;
+    for (uint8_t seg = 0; seg < 2; seg++)
+    {
+        for (uint16_t j = 0; j < p_span->num[seg]; j++, i++)
+        {
+            if (p_span->p_seg[seg][j] != p_expected[i * stride])
+                return 1;
+        }
+    }
+
+    if (num == 0)
+        return 0;
+
+    const uint16_t offset = random_() % num;
+    const uint16_t slice_num = random_() % (num - offset + 1);
+    edgeai_span_t slice;
+    edgeai_span_slice(p_span, offset, slice_num, &slice);
+
+    if (slice.num[0] + slice.num[1] != slice_num)
+        return 1;
+
+    i = 0;
+    for (uint8_t seg = 0; seg < 2; seg++)
+    {
+        for (uint16_t j = 0; j < slice.num[seg]; j++, i++)
+        {
+            if (slice.p_seg[seg][j] != p_expected[(offset + i) * stride])
+                return 1;
+        }
+    }
+
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void random_frames_(int16_t* p_frames, uint16_t frames_num, uint16_t axes_num)
+{
+    for (uint32_t i = 0; i < (uint32_t)frames_num * axes_num; i++)
+        p_frames[i] = (int16_t)random_();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Step by step feed of one thread, same samples left and window columns as the library window */
+static uint32_t feed_check_(uint16_t capacity, uint16_t size, uint16_t shift, uint16_t axes_num)
+{
+    edgeai_window_t window;
+    edgeai_window_init(&window, ring_buffer_, capacity, size, shift, axes_num);
+
+    reference_window_t ref = { .size = size, .shift = shift, .axes_num = axes_num };
+
+    for (uint16_t step = 0; step < WINDOW_STEPS_NUM; step++)
+    {
+        const uint16_t frames_num = random_() % (size + 1);
+        random_frames_(frames_, frames_num, axes_num);
+
+        const uint16_t left = edgeai_window_feed(&window, frames_, frames_num);
+        const uint16_t expected_left = reference_feed_(&ref, frames_, frames_num);
+        if (left != expected_left)
+        {
+            printf("feed: capacity %u size %u shift %u step %u: left %u, expected %u\n",
+                   capacity, size, shift, step, left, expected_left);
+            return 1;
+        }
+
+        const uint16_t expected_samples_left = (ref.filled >= size) ? shift : (size - ref.filled);
+        if (edgeai_window_samples_left(&window) != expected_samples_left)
+        {
+            printf("feed: capacity %u size %u shift %u step %u: samples left %u, expected %u\n",
+                   capacity, size, shift, step, edgeai_window_samples_left(&window), expected_samples_left);
+            return 1;
+        }
+
+        for (uint16_t axis = 0; axis < axes_num; axis++)
+        {
+            edgeai_span_t span;
+            edgeai_window_span(&window, axis, &span);
+            if (span_check_(&span, ref.columns[axis], ref.filled, 1) != 0)
+            {
+                printf("feed: capacity %u size %u shift %u step %u axis %u: span differs\n",
+                       capacity, size, shift, step, axis);
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Blocks pushed past the complete window, the ready windows are read by their stream positions
+ *  and slid, some of them later, with the shift changed between the windows */
+static uint32_t push_check_(uint16_t capacity, uint16_t size, uint16_t shift, uint16_t axes_num)
+{
+    edgeai_window_t window;
+    edgeai_window_init(&window, ring_buffer_, capacity, size, shift, axes_num);
+
+    uint32_t pushed_num = 0;
+    uint32_t start = 0;
+
+    for (uint16_t step = 0; step < WINDOW_STEPS_NUM; step++)
+    {
+        const uint16_t frames_num = random_() % (FRAMES_BLOCK_MAX + 1);
+        int16_t* p_frames = &stream_[pushed_num * axes_num];
+        random_frames_(p_frames, frames_num, axes_num);
+
+        const uint16_t free_num = capacity - (uint16_t)(pushed_num - start);
+        const uint16_t stored_num = edgeai_window_push(&window, p_frames, frames_num);
+        if (stored_num != MIN(frames_num, free_num))
+        {
+            printf("push: capacity %u size %u step %u: stored %u of %u, free %u\n",
+                   capacity, size, step, stored_num, frames_num, free_num);
+            return 1;
+        }
+        pushed_num += stored_num;
+
+        const uint32_t filled = pushed_num - start;
+        const uint16_t expected_ready = (filled < size) ? 0 : (uint16_t)(1 + (filled - size) / window.shift);
+        if (edgeai_window_ready(&window) != expected_ready)
+        {
+            printf("push: capacity %u size %u shift %u step %u: ready %u, expected %u\n",
+                   capacity, size, window.shift, step, edgeai_window_ready(&window), expected_ready);
+            return 1;
+        }
+
+        /** Some of the ready windows are left for the next steps */
+        uint16_t slides_num = (expected_ready > 0) ? random_() % (expected_ready + 1) : 0;
+        if (filled == capacity)
+            slides_num = MAX(slides_num, 1);
+
+        /** A longer shift set between the windows may leave fewer of them ready */
+        for (uint16_t i = 0; (i < slides_num) && (edgeai_window_ready(&window) > 0); i++)
+        {
+            if (edgeai_window_start(&window) != start)
+            {
+                printf("push: capacity %u size %u step %u: window start %u, expected %u\n",
+                       capacity, size, step, edgeai_window_start(&window), start);
+                return 1;
+            }
+
+            for (uint16_t axis = 0; axis < axes_num; axis++)
+            {
+                edgeai_span_t span;
+                edgeai_window_span(&window, axis, &span);
+                if (span_check_(&span, &stream_[start * axes_num + axis], size, axes_num) != 0)
+                {
+                    printf("push: capacity %u size %u shift %u step %u axis %u: window at %u differs\n",
+                           capacity, size, window.shift, step, axis, start);
+                    return 1;
+                }
+            }
+
+            start += window.shift;
+            edgeai_window_slide(&window);
+
+            /** Shift of the next window, e.g. a latency trade-off changed at runtime */
+            if ((random_() % 8) == 0)
+                edgeai_window_set_shift(&window, 1 + random_() % size);
+        }
+    }
+
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int main(void)
+{
+    uint32_t errors_num = 0;
+
+    for (uint32_t i = 0; i < DEINTERLEAVE_CASES_NUM; i++)
+        errors_num += deinterleave_check_();
+
+    /** Ring capacities equal to the window, not multiples of the shift and much longer than the window */
+    for (uint32_t i = 0; i < WINDOW_CASES_NUM; i++)
+    {
+        const uint16_t size = 1 + random_() % WINDOW_SIZE_MAX;
+        const uint16_t shift = 1 + random_() % size;
+        const uint16_t capacity = (i % 3 == 0) ? size : (size + random_() % (RING_CAPACITY_MAX - size + 1));
+        const uint16_t axes_num = (random_() & 1) ? 6 : (1 + random_() % AXES_MAX);
+
+        errors_num += feed_check_(capacity, size, shift, axes_num);
+        errors_num += push_check_(capacity, size, shift, axes_num);
+    }
+
+    printf("edgeai_window (%s deinterleave): %u deinterleave cases, %u windows, %u mismatches\n",
+           IS_ENABLED(TEST_DEINTERLEAVE_PORTABLE) ? "portable" : "SSE2",
+           DEINTERLEAVE_CASES_NUM, WINDOW_CASES_NUM, errors_num);
+
+    return (errors_num == 0) ? 0 : 1;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+// ///////////////////////// Package Header Files ////////////////////////////
+#include "imu_decimator.h"
+#include <zephyr/sys/util.h>
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * Decimator output is compared with a direct-form FIR over the whole input, for every ratio,
+ * in place and in chunks of arbitrary size. Time per input frame is measured at ratio 8,
+ * the IMU is sampled at 800 Hz then.
+ */
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define FRAME_LEN           (6)
+#define RATIO_MAX           (8)
+#define FRAMES_NUM          (4096)
+#define BENCH_RATIO         (8)
+#define BENCH_INPUT_HZ      (800)
+#define BENCH_FRAMES_NUM    (BENCH_INPUT_HZ * 60)
+#define BENCH_CHUNK_FRAMES  (264)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int16_t coeffs_[IMU_DECIMATOR_TAPS(RATIO_MAX)];
+static int16_t history_[IMU_DECIMATOR_HISTORY_LEN(RATIO_MAX, FRAME_LEN)];
+static int16_t input_[FRAMES_NUM * FRAME_LEN];
+static int16_t frames_[FRAMES_NUM * FRAME_LEN];
+static int16_t expected_[FRAMES_NUM * FRAME_LEN];
+static int16_t bench_frames_[BENCH_FRAMES_NUM * FRAME_LEN];
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Direct-form FIR of the whole input, samples before the input are zero */
+static uint16_t reference_decimate_(const int16_t* p_coeffs, uint16_t taps_num, uint8_t ratio, int16_t* p_out)
+{
+    uint16_t out_frames = 0;
+
+    for (uint32_t frame = ratio - 1; frame < FRAMES_NUM; frame += ratio)
+    {
+        for (uint8_t axis = 0; axis < FRAME_LEN; axis++)
+        {
+            int32_t acc = 1 << 14;
+            for (uint16_t k = 0; (k < taps_num) && (k <= frame); k++)
+                acc += (int32_t)p_coeffs[k] * input_[(frame - k) * FRAME_LEN + axis];
+
+            acc >>= 15;
+            p_out[out_frames * FRAME_LEN + axis] = (int16_t)CLAMP(acc, INT16_MIN, INT16_MAX);
+        }
+        out_frames++;
+    }
+
+    return out_frames;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t ratio_check_(uint8_t ratio)
+{
+    imu_decimator_t dec;
+    imu_decimator_init(&dec, ratio, FRAME_LEN, coeffs_, history_);
+    const uint16_t expected_num = (ratio > 1) ? reference_decimate_(coeffs_, dec.taps_num, ratio, expected_) : FRAMES_NUM;
+    if (ratio == 1)
+        memcpy(expected_, input_, sizeof(input_));
+
+    /** In place, in chunks of pseudo random size */
+    memcpy(frames_, input_, sizeof(input_));
+    uint16_t in_frames = 0;
+    uint16_t out_frames = 0;
+    while (in_frames < FRAMES_NUM)
+    {
+        const uint16_t chunk_max = 1 + rand() % 300;
+        const uint16_t chunk = MIN(chunk_max, FRAMES_NUM - in_frames);
+        int16_t* p_chunk = &frames_[in_frames * FRAME_LEN];
+        const uint16_t chunk_out = imu_decimator_process(&dec, p_chunk, chunk, p_chunk);
+
+        memmove(&frames_[out_frames * FRAME_LEN], p_chunk, chunk_out * FRAME_LEN * sizeof(int16_t));
+        in_frames += chunk;
+        out_frames += chunk_out;
+    }
+
+    uint32_t errors_num = 0;
+    if (out_frames != expected_num)
+    {
+        printf("ratio %u: %u output frames, expected %u\n", ratio, out_frames, expected_num);
+        return 1;
+    }
+
+    for (uint32_t i = 0; i < (uint32_t)out_frames * FRAME_LEN; i++)
+    {
+        if (frames_[i] != expected_[i])
+        {
+            if (errors_num < 8)
+                printf("ratio %u: value %u is %d, expected %d\n", ratio, i, frames_[i], expected_[i]);
+            errors_num++;
+        }
+    }
+
+    return errors_num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static double bench_ns_per_frame_(void)
+{
+    imu_decimator_t dec;
+    imu_decimator_init(&dec, BENCH_RATIO, FRAME_LEN, coeffs_, history_);
+
+    for (uint32_t i = 0; i < BENCH_FRAMES_NUM * FRAME_LEN; i++)
+        bench_frames_[i] = (int16_t)(rand() - RAND_MAX / 2);
+
+    /** FIFO drains of 33 model rate frames */
+    struct timespec start;
+    struct timespec stop;
+    volatile uint32_t out_frames = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t frame = 0; frame < BENCH_FRAMES_NUM; frame += BENCH_CHUNK_FRAMES)
+    {
+        int16_t* p_chunk = &bench_frames_[frame * FRAME_LEN];
+        const uint16_t chunk = MIN(BENCH_CHUNK_FRAMES, BENCH_FRAMES_NUM - frame);
+        out_frames += imu_decimator_process(&dec, p_chunk, chunk, p_chunk);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    const double ns = (stop.tv_sec - start.tv_sec) * 1e9 + (stop.tv_nsec - start.tv_nsec);
+    return ns / BENCH_FRAMES_NUM;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int main(void)
+{
+    uint32_t errors_num = 0;
+
+    srand(1);
+    for (uint32_t i = 0; i < FRAMES_NUM * FRAME_LEN; i++)
+    {
+        /** Random samples, with full-scale steps to exercise the output saturation */
+        input_[i] = ((i / FRAME_LEN) % 512 < 32) ? (((i / FRAME_LEN) % 64 < 32) ? INT16_MAX : INT16_MIN)
+                                                 : (int16_t)(rand() - RAND_MAX / 2);
+    }
+
+    for (uint8_t ratio = 1; ratio <= RATIO_MAX; ratio *= 2)
+        errors_num += ratio_check_(ratio);
+
+    const double ns_per_frame = bench_ns_per_frame_();
+    printf("imu_decimator: %u mismatches, ratio %u: %.1f ns per input frame, %.3f%% of a core at %u Hz\n",
+           errors_num, BENCH_RATIO, ns_per_frame, ns_per_frame * BENCH_INPUT_HZ * 1e-7, BENCH_INPUT_HZ);
+
+    return (errors_num == 0) ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+// ///////////////////////// Package Header Files ////////////////////////////
+#include <zephyr/kernel.h>
+#include <nrf_edgeai/nrf_edgeai.h>
+#include <nrf_edgeai_generated/nrf_edgeai_user_model.h>
+#include <button/bsp_button.h>
+#include <led/bsp_led.h>
+#include "ble/hid/ble_hid.h"
+#include "inference_postprocessing.h"
+#include "edgeai_runtime.h"
+// /////////////////////// Standard C Header Files ///////////////////////////
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * The application main loop, acquisition thread and inference thread of main.c run on the replay
+ * backend in max-speed mode, scheduled by the Zephyr thread priorities. Every frame of the CSV file
+ * has to reach edgeai_runtime_feed() in order, the model window storage is emulated, so the feed
+ * also stops until the inference thread processes the ready windows.
+ */
+
+/** main.c main() is built as app_main() */
+#undef main
+int app_main(void);
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define FRAME_AXES_NUM          (6)
+#define REPLAY_FRAMES_NUM       (5003)
+/** Emulated model window storage, a window per shift of frames, up to the storage windows are kept */
+#define MODEL_WINDOW_SHIFT      (33)
+#define MODEL_STORAGE_WINDOWS   (1)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static nrf_edgeai_t model_;
+static uint32_t fed_frames_num_ = 0;
+static uint32_t mismatches_num_ = 0;
+static uint32_t stored_frames_ = 0;
+static uint32_t feed_stalls_num_ = 0;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Frame of the replay file, the frame index is in the first two axes so lost or reordered frames show */
+static void replay_frame_(uint32_t index, int16_t* p_frame)
+{
+    p_frame[0] = (int16_t)(index & 0x3FFF);
+    p_frame[1] = (int16_t)(index >> 14);
+    for (int axis = 2; axis < FRAME_AXES_NUM; axis++)
+        p_frame[axis] = (int16_t)((int32_t)((index * 2654435761u) >> (axis * 4)) % 20000 - 10000);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int replay_file_write_(const char* p_path)
+{
+    FILE* p_file = fopen(p_path, "w");
+    if (p_file == NULL)
+        return -1;
+
+    /** Boot log captured together with the data is skipped by the replay */
+    fprintf(p_file, "*** Booting nRF Connect SDK ***\r\n");
+
+    for (uint32_t i = 0; i < REPLAY_FRAMES_NUM; i++)
+    {
+        int16_t frame[FRAME_AXES_NUM];
+        replay_frame_(i, frame);
+        fprintf(p_file, "%d,%d,%d,%d,%d,%d\r\n", frame[0], frame[1], frame[2], frame[3], frame[4], frame[5]);
+    }
+
+    return fclose(p_file);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint16_t edgeai_runtime_feed(nrf_edgeai_t* p_edgeai,
+                             const int16_t* p_frames,
+                             uint16_t frames_num,
+                             uint16_t* p_fed_num)
+{
+    (void)p_edgeai;
+
+    const uint32_t free_frames = MODEL_STORAGE_WINDOWS * MODEL_WINDOW_SHIFT - stored_frames_;
+    const uint16_t fed_num = (uint16_t)MIN(frames_num, free_frames);
+
+    for (uint16_t i = 0; i < fed_num; i++)
+    {
+        int16_t expected[FRAME_AXES_NUM];
+        replay_frame_(fed_frames_num_ + i, expected);
+
+        if (memcmp(expected, &p_frames[i * FRAME_AXES_NUM], sizeof(expected)) != 0)
+        {
+            if (mismatches_num_ < 8)
+                printf("frame %u fed: %d,%d, expected %d,%d\n", fed_frames_num_ + i,
+                       p_frames[i * FRAME_AXES_NUM], p_frames[i * FRAME_AXES_NUM + 1], expected[0], expected[1]);
+            mismatches_num_++;
+        }
+    }
+
+    if (fed_num < frames_num)
+        feed_stalls_num_++;
+
+    fed_frames_num_ += fed_num;
+    stored_frames_ += fed_num;
+    *p_fed_num = fed_num;
+
+    return (uint16_t)(stored_frames_ / MODEL_WINDOW_SHIFT);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint16_t edgeai_runtime_run_windows(nrf_edgeai_t* p_edgeai, edgeai_runtime_output_cb_t output_cb)
+{
+    (void)p_edgeai;
+    (void)output_cb;
+
+    const uint16_t windows_num = (uint16_t)(stored_frames_ / MODEL_WINDOW_SHIFT);
+    stored_frames_ -= windows_num * MODEL_WINDOW_SHIFT;
+
+    return windows_num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+nrf_edgeai_err_t edgeai_runtime_init(nrf_edgeai_t* p_edgeai, int16_t* p_ring, uint16_t ring_frames)
+{
+    (void)p_edgeai;
+    (void)p_ring;
+    (void)ring_frames;
+
+    return NRF_EDGEAI_ERR_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Model, board and BLE functions used by main.c, not involved in the acquisition */
+
+nrf_edgeai_t* nrf_edgeai_user_model(void) { return &model_; }
+bool nrf_edgeai_is_runtime_compatible(const nrf_edgeai_t* p_edgeai) { (void)p_edgeai; return true; }
+nrf_edgeai_rt_version_t nrf_edgeai_runtime_version(void) { return (nrf_edgeai_rt_version_t){ 0 }; }
+const char* nrf_edgeai_solution_id_str(const nrf_edgeai_t* p_edgeai) { (void)p_edgeai; return "host"; }
+
+void inference_postprocess(const uint16_t predicted_target, const inference_probability_t probability,
+                           const bool do_postprocessing, inference_postprocess_cb_t callback)
+{
+    (void)predicted_target;
+    (void)probability;
+    (void)do_postprocessing;
+    (void)callback;
+}
+
+int ble_hid_init(ble_connection_cb_t cb) { (void)cb; return 0; }
+int ble_hid_send_key(ble_hid_key_t key) { (void)key; return 0; }
+int bsp_led_init(void) { return 0; }
+int bsp_led_set_red(float brightness) { (void)brightness; return 0; }
+int bsp_led_set_green(float brightness) { (void)brightness; return 0; }
+int bsp_led_set_blue(float brightness) { (void)brightness; return 0; }
+int bsp_led_off(void) { return 0; }
+int bsp_button_init(void) { return 0; }
+void bsp_button_reg_click_handler(bsp_button_click_handler_t click_handler) { (void)click_handler; }
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void app_main_thread_(void* p1, void* p2, void* p3)
+{
+    (void)p1;
+    (void)p2;
+    (void)p3;
+
+    app_main();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int main(void)
+{
+    if (replay_file_write_(CONFIG_BSP_IMU_REPLAY_FILE) != 0)
+    {
+        printf("failed to write %s\n", CONFIG_BSP_IMU_REPLAY_FILE);
+        return 1;
+    }
+
+    /** Replay ends when every thread waits, the last frames are fed by then */
+    k_host_run_until_idle(app_main_thread_, CONFIG_MAIN_THREAD_PRIORITY);
+
+    printf("replay frames %u, fed %u, mismatches %u, feed stalls %u\n",
+           REPLAY_FRAMES_NUM, fed_frames_num_, mismatches_num_, feed_stalls_num_);
+
+    const bool is_passed = (fed_frames_num_ == REPLAY_FRAMES_NUM) && (mismatches_num_ == 0) && (feed_stalls_num_ > 0);
+    printf("%s\n", is_passed ? "PASSED" : "FAILED");
+
+    return is_passed ? 0 : 1;
+}